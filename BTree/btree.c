@@ -0,0 +1,681 @@
+#include <stdlib.h>
+#include <string.h>
+#include "btree.h"
+
+#define _CACHE_LINE	64
+#define _MAX_HEIGHT	64	// Every inner node has at least two children.
+
+//  A step of the path from the root to a leaf: an inner node and the child taken.
+struct _BTreeStep
+{
+	struct _BTreeNode* node;
+	int index;
+};
+
+static long _align(long offset, long alignment) {
+	return( (offset + alignment - 1) / alignment * alignment);
+}
+
+static void* _key(const BTree* tree, const struct _BTreeNode* node, int index) {
+	return( (void*) node + sizeof(struct _BTreeNode) + (long) index * tree->_keySize);
+}
+
+static void* _value(const BTree* tree, const struct _BTreeNode* node, int index) {
+	return( (void*) node + tree->_valuesOffset + (long) index * tree->_valueSize);
+}
+
+static struct _BTreeNode** _children(const BTree* tree, const struct _BTreeNode* node) {
+	return( (struct _BTreeNode**) ( (void*) node + tree->_childrenOffset) );
+}
+
+static int _compare(const BTree* tree, const void* a, const void* b) {
+	return(tree->_keyCompare( (void*) a, (void*) b) );
+}
+
+//  Fewest keys a node other than the root may hold. Merging a node one below the
+//  minimum with a sibling at the minimum always fits in one node.
+static int _minimum(const BTree* tree, const struct _BTreeNode* node) {
+	return(node->leaf ? tree->_leafCapacity / 2 : (tree->_innerCapacity - 1) / 2);
+}
+
+//  Derives the node capacities from BTREE_NODE_SIZE. Keys are packed right after the
+//  header so that a search within a node reads consecutive cache lines.
+static void _layout(BTree* tree, int keySize, int valueSize) {
+	long header = sizeof(struct _BTreeNode);
+	long leafCapacity = (BTREE_NODE_SIZE - header - sizeof(long) ) / (keySize + valueSize);
+	long innerCapacity = (BTREE_NODE_SIZE - header - 2 * sizeof(void*) ) / (keySize + sizeof(void*) );
+
+	leafCapacity = (leafCapacity < BTREE_MIN_CAPACITY) ? BTREE_MIN_CAPACITY : leafCapacity;
+	innerCapacity = (innerCapacity < BTREE_MIN_CAPACITY) ? BTREE_MIN_CAPACITY : innerCapacity;
+
+	tree->_keySize = keySize;
+	tree->_valueSize = valueSize;
+	tree->_leafCapacity = leafCapacity;
+	tree->_innerCapacity = innerCapacity;
+	tree->_valuesOffset = _align(header + leafCapacity * keySize, sizeof(long) );
+	tree->_childrenOffset = _align(header + innerCapacity * keySize, sizeof(void*) );
+	tree->_leafBytes = _align(tree->_valuesOffset + leafCapacity * valueSize, _CACHE_LINE);
+	tree->_innerBytes = _align(tree->_childrenOffset + (innerCapacity + 1) * sizeof(void*), _CACHE_LINE);
+}
+
+static struct _BTreeNode* _allocNode(const BTree* tree, int leaf) {
+	struct _BTreeNode* node = aligned_alloc(_CACHE_LINE, leaf ? tree->_leafBytes : tree->_innerBytes);
+
+	if(node != NULL) {
+		node->count = 0;
+		node->leaf = leaf;
+		node->next = NULL;
+		node->prev = NULL;
+	}
+	return(node);
+}
+
+static void _freeNodes(struct _BTreeNode** nodes, long count) {
+	for(long i = 0; i < count; i++) {
+		free(nodes[i]);
+	}
+}
+
+//  First index in node whose key is not less than key.
+static int _lowerBound(const BTree* tree, const struct _BTreeNode* node, const void* key) {
+	int low = 0;
+	int high = node->count;
+
+	while(low < high) {
+		int middle = (low + high) / 2;
+
+		if(_compare(tree, _key(tree, node, middle), key) < 0) {
+			low = middle + 1;
+		}
+		else {
+			high = middle;
+		}
+	}
+	return(low);
+}
+
+//  First index in node whose key is greater than key; the child of an inner node which
+//  holds key.
+static int _upperBound(const BTree* tree, const struct _BTreeNode* node, const void* key) {
+	int low = 0;
+	int high = node->count;
+
+	while(low < high) {
+		int middle = (low + high) / 2;
+
+		if(_compare(tree, _key(tree, node, middle), key) <= 0) {
+			low = middle + 1;
+		}
+		else {
+			high = middle;
+		}
+	}
+	return(low);
+}
+
+//  Descends to the leaf which holds key, recording the path if path is not NULL.
+static struct _BTreeNode* _descend(const BTree* tree, const void* key, struct _BTreeStep* path, int* depth) {
+	struct _BTreeNode* node = tree->_root;
+	int level = 0;
+
+	while(!node->leaf) {
+		int index = _upperBound(tree, node, key);
+
+		if(path != NULL) {
+			path[level].node = node;
+			path[level].index = index;
+		}
+		level++;
+		node = _children(tree, node)[index];
+	}
+	if(depth != NULL) {
+		*depth = level;
+	}
+	return(node);
+}
+
+static void _moveKeys(const BTree* tree, struct _BTreeNode* to, int toIndex, const struct _BTreeNode* from, int fromIndex, int count) {
+	memmove(_key(tree, to, toIndex), _key(tree, from, fromIndex), (long) count * tree->_keySize);
+}
+
+static void _moveValues(const BTree* tree, struct _BTreeNode* to, int toIndex, const struct _BTreeNode* from, int fromIndex, int count) {
+	memmove(_value(tree, to, toIndex), _value(tree, from, fromIndex), (long) count * tree->_valueSize);
+}
+
+static void _moveChildren(const BTree* tree, struct _BTreeNode* to, int toIndex, const struct _BTreeNode* from, int fromIndex, int count) {
+	memmove(_children(tree, to) + toIndex, _children(tree, from) + fromIndex, count * sizeof(struct _BTreeNode*) );
+}
+
+static void _leafInsertAt(const BTree* tree, struct _BTreeNode* leaf, int index, const void* key, const void* value) {
+	_moveKeys(tree, leaf, index + 1, leaf, index, leaf->count - index);
+	_moveValues(tree, leaf, index + 1, leaf, index, leaf->count - index);
+	memcpy(_key(tree, leaf, index), key, tree->_keySize);
+	if(tree->_valueSize > 0) {
+		memcpy(_value(tree, leaf, index), value, tree->_valueSize);
+	}
+	leaf->count++;
+}
+
+//  Inserts key at index, with child to its right.
+static void _innerInsertAt(const BTree* tree, struct _BTreeNode* node, int index, const void* key, struct _BTreeNode* child) {
+	_moveKeys(tree, node, index + 1, node, index, node->count - index);
+	_moveChildren(tree, node, index + 2, node, index + 1, node->count - index);
+	memcpy(_key(tree, node, index), key, tree->_keySize);
+	_children(tree, node)[index + 1] = child;
+	node->count++;
+}
+
+//  Moves the upper half of a full leaf into right, links it in, and inserts the new
+//  entry into whichever half it belongs to. The first key of right is left in scratch.
+static void _splitLeaf(BTree* tree, struct _BTreeNode* leaf, struct _BTreeNode* right, int index, const void* key, const void* value) {
+	int half = leaf->count / 2;
+
+	right->count = leaf->count - half;
+	_moveKeys(tree, right, 0, leaf, half, right->count);
+	_moveValues(tree, right, 0, leaf, half, right->count);
+	leaf->count = half;
+
+	right->next = leaf->next;
+	right->prev = leaf;
+	if(leaf->next != NULL) {
+		leaf->next->prev = right;
+	}
+	leaf->next = right;
+
+	if(index <= half) {
+		_leafInsertAt(tree, leaf, index, key, value);
+	}
+	else {
+		_leafInsertAt(tree, right, index - half, key, value);
+	}
+	memcpy(tree->_scratch, _key(tree, right, 0), tree->_keySize);
+}
+
+//  Splits a full inner node around its middle key, and inserts the separator in scratch
+//  with child to its right. The middle key, which moves up, is left in scratch.
+static void _splitInner(BTree* tree, struct _BTreeNode* node, struct _BTreeNode* right, int index, struct _BTreeNode* child) {
+	int middle = node->count / 2;
+	void* promoted = tree->_scratch + tree->_keySize;
+
+	memcpy(promoted, _key(tree, node, middle), tree->_keySize);
+	right->count = node->count - middle - 1;
+	_moveKeys(tree, right, 0, node, middle + 1, right->count);
+	_moveChildren(tree, right, 0, node, middle + 1, right->count + 1);
+	node->count = middle;
+
+	if(index <= middle) {
+		_innerInsertAt(tree, node, index, tree->_scratch, child);
+	}
+	else {
+		_innerInsertAt(tree, right, index - middle - 1, tree->_scratch, child);
+	}
+	memcpy(tree->_scratch, promoted, tree->_keySize);
+}
+
+//  Merges children[index + 1] of parent into children[index] and frees it.
+static void _merge(BTree* tree, struct _BTreeNode* parent, int index) {
+	struct _BTreeNode* left = _children(tree, parent)[index];
+	struct _BTreeNode* right = _children(tree, parent)[index + 1];
+
+	if(left->leaf) {
+		_moveKeys(tree, left, left->count, right, 0, right->count);
+		_moveValues(tree, left, left->count, right, 0, right->count);
+		left->count += right->count;
+		left->next = right->next;
+		if(right->next != NULL) {
+			right->next->prev = left;
+		}
+	}
+	else {
+		memcpy(_key(tree, left, left->count), _key(tree, parent, index), tree->_keySize);
+		_moveKeys(tree, left, left->count + 1, right, 0, right->count);
+		_moveChildren(tree, left, left->count + 1, right, 0, right->count + 1);
+		left->count += right->count + 1;
+	}
+	_moveKeys(tree, parent, index, parent, index + 1, parent->count - index - 1);
+	_moveChildren(tree, parent, index + 1, parent, index + 2, parent->count - index - 1);
+	parent->count--;
+	free(right);
+}
+
+//  Moves the last entry of children[index - 1] to the front of children[index].
+static void _borrowLeft(BTree* tree, struct _BTreeNode* parent, int index) {
+	struct _BTreeNode* left = _children(tree, parent)[index - 1];
+	struct _BTreeNode* child = _children(tree, parent)[index];
+
+	_moveKeys(tree, child, 1, child, 0, child->count);
+	if(child->leaf) {
+		_moveValues(tree, child, 1, child, 0, child->count);
+		memcpy(_key(tree, child, 0), _key(tree, left, left->count - 1), tree->_keySize);
+		memcpy(_value(tree, child, 0), _value(tree, left, left->count - 1), tree->_valueSize);
+		memcpy(_key(tree, parent, index - 1), _key(tree, child, 0), tree->_keySize);
+	}
+	else {
+		_moveChildren(tree, child, 1, child, 0, child->count + 1);
+		memcpy(_key(tree, child, 0), _key(tree, parent, index - 1), tree->_keySize);
+		_children(tree, child)[0] = _children(tree, left)[left->count];
+		memcpy(_key(tree, parent, index - 1), _key(tree, left, left->count - 1), tree->_keySize);
+	}
+	left->count--;
+	child->count++;
+}
+
+//  Moves the first entry of children[index + 1] to the end of children[index].
+static void _borrowRight(BTree* tree, struct _BTreeNode* parent, int index) {
+	struct _BTreeNode* child = _children(tree, parent)[index];
+	struct _BTreeNode* right = _children(tree, parent)[index + 1];
+
+	if(child->leaf) {
+		memcpy(_key(tree, child, child->count), _key(tree, right, 0), tree->_keySize);
+		memcpy(_value(tree, child, child->count), _value(tree, right, 0), tree->_valueSize);
+		_moveKeys(tree, right, 0, right, 1, right->count - 1);
+		_moveValues(tree, right, 0, right, 1, right->count - 1);
+		memcpy(_key(tree, parent, index), _key(tree, right, 0), tree->_keySize);
+	}
+	else {
+		memcpy(_key(tree, child, child->count), _key(tree, parent, index), tree->_keySize);
+		_children(tree, child)[child->count + 1] = _children(tree, right)[0];
+		memcpy(_key(tree, parent, index), _key(tree, right, 0), tree->_keySize);
+		_moveKeys(tree, right, 0, right, 1, right->count - 1);
+		_moveChildren(tree, right, 0, right, 1, right->count);
+	}
+	right->count--;
+	child->count++;
+}
+
+//  Refills children[index] of parent, which has fallen below the minimum, from a
+//  sibling with keys to spare, or else merges it with a sibling.
+static void _rebalance(BTree* tree, struct _BTreeNode* parent, int index) {
+	struct _BTreeNode* left = (index > 0) ? _children(tree, parent)[index - 1] : NULL;
+	struct _BTreeNode* right = (index < parent->count) ? _children(tree, parent)[index + 1] : NULL;
+	int minimum = _minimum(tree, _children(tree, parent)[index]);
+
+	if(left != NULL && left->count > minimum) {
+		_borrowLeft(tree, parent, index);
+	}
+	else if(right != NULL && right->count > minimum) {
+		_borrowRight(tree, parent, index);
+	}
+	else if(left != NULL) {
+		_merge(tree, parent, index - 1);
+	}
+	else {
+		_merge(tree, parent, index);
+	}
+}
+
+static void _destroyNode(BTree* tree, struct _BTreeNode* node) {
+	if(node->leaf) {
+		if(tree->_valueDestructor != NULL) {
+			for(int i = 0; i < node->count; i++) {
+				tree->_valueDestructor(_value(tree, node, i) );
+			}
+		}
+	}
+	else {
+		for(int i = 0; i <= node->count; i++) {
+			_destroyNode(tree, _children(tree, node)[i]);
+		}
+	}
+	free(node);
+}
+
+int BTree_create(BTree* tree, int keySize, int valueSize, int (*keyCompare)(void*, void*), int (*valueDestructor)(void*)) {
+	if(tree == NULL || keyCompare == NULL) {
+		return(BTREE_ERR_NULL_ARG);
+	}
+	if(keySize < 1 || valueSize < 0) {
+		return(BTREE_ERR_INVALID_ARG);
+	}
+	_layout(tree, keySize, valueSize);
+	tree->_scratch = malloc(2 * keySize);
+	tree->_root = _allocNode(tree, 1);
+	if(tree->_scratch == NULL || tree->_root == NULL) {
+		free(tree->_scratch);
+		free(tree->_root);
+		return(BTREE_ERR_ALLOCATION);
+	}
+	tree->_firstLeaf = tree->_root;
+	tree->_size = 0;
+	tree->_keyCompare = keyCompare;
+	tree->_valueDestructor = valueDestructor;
+
+	return(BTREE_FUNC_SUCCESS);
+}
+
+int BTree_fromVectors(BTree* tree, const Vector* keys, const Vector* values, int (*keyCompare)(void*, void*), int (*valueDestructor)(void*)) {
+	if(tree == NULL || keys == NULL || keyCompare == NULL) {
+		return(BTREE_ERR_NULL_ARG);
+	}
+	long size = Vector_size(keys);
+
+	if(values != NULL && Vector_size(values) != size) {
+		return(BTREE_ERR_INVALID_ARG);
+	}
+	for(long i = 1; i < size; i++) {
+		if(keyCompare(Vector_get(keys, i - 1), Vector_get(keys, i) ) >= 0) {
+			return(BTREE_ERR_INVALID_ARG);
+		}
+	}
+	int returnVal = BTree_create(tree, keys->_elementSize, (values != NULL) ? values->_elementSize : 0, keyCompare, valueDestructor);
+
+	if(returnVal != BTREE_FUNC_SUCCESS || size == 0) {
+		return(returnVal);
+	}
+	//  Count the nodes of every level, so they can all be allocated before any is filled.
+	long leafCount = (size + tree->_leafCapacity - 1) / tree->_leafCapacity;
+	long nodeCount = leafCount;
+
+	for(long count = leafCount; count > 1; ) {
+		count = (count + tree->_innerCapacity) / (tree->_innerCapacity + 1);
+		nodeCount += count;
+	}
+	struct _BTreeNode** nodes = malloc(nodeCount * sizeof(struct _BTreeNode*) );
+	const void** firstKeys = malloc(leafCount * sizeof(void*) );	// Smallest key under each node of a level.
+	long allocated = 0;
+
+	while(nodes != NULL && firstKeys != NULL && allocated < nodeCount) {
+		nodes[allocated] = _allocNode(tree, allocated < leafCount);
+		if(nodes[allocated] == NULL) {
+			break;
+		}
+		allocated++;
+	}
+	if(allocated < nodeCount) {
+		if(nodes != NULL) {
+			_freeNodes(nodes, allocated);
+		}
+		free(nodes);
+		free(firstKeys);
+		BTree_destroy(tree);
+		return(BTREE_ERR_ALLOCATION);
+	}
+	//  Leaves take the keys and values in runs, spread evenly so that none is below the
+	//  minimum fill.
+	long offset = 0;
+
+	for(long i = 0; i < leafCount; i++) {
+		struct _BTreeNode* leaf = nodes[i];
+
+		leaf->count = size / leafCount + (i < size % leafCount);
+		memcpy(_key(tree, leaf, 0), Vector_get(keys, offset), (long) leaf->count * tree->_keySize);
+		if(values != NULL) {
+			memcpy(_value(tree, leaf, 0), Vector_get(values, offset), (long) leaf->count * tree->_valueSize);
+		}
+		leaf->prev = (i > 0) ? nodes[i - 1] : NULL;
+		leaf->next = (i + 1 < leafCount) ? nodes[i + 1] : NULL;
+		firstKeys[i] = _key(tree, leaf, 0);
+		offset += leaf->count;
+	}
+	//  Each inner level takes the level below in runs of children, with the smallest key
+	//  under each child after the first as its separator.
+	struct _BTreeNode** level = nodes;
+	long levelCount = leafCount;
+
+	while(levelCount > 1) {
+		struct _BTreeNode** parents = level + levelCount;
+		long parentCount = (levelCount + tree->_innerCapacity) / (tree->_innerCapacity + 1);
+		long child = 0;
+
+		for(long i = 0; i < parentCount; i++) {
+			struct _BTreeNode* parent = parents[i];
+			int childCount = levelCount / parentCount + (i < levelCount % parentCount);
+
+			_children(tree, parent)[0] = level[child];
+			firstKeys[i] = firstKeys[child];
+			for(int j = 1; j < childCount; j++) {
+				memcpy(_key(tree, parent, j - 1), firstKeys[child + j], tree->_keySize);
+				_children(tree, parent)[j] = level[child + j];
+			}
+			parent->count = childCount - 1;
+			child += childCount;
+		}
+		level = parents;
+		levelCount = parentCount;
+	}
+	free(tree->_root);
+	tree->_root = level[0];
+	tree->_firstLeaf = nodes[0];
+	tree->_size = size;
+	free(nodes);
+	free(firstKeys);
+
+	return(BTREE_FUNC_SUCCESS);
+}
+
+int BTree_destroy(BTree* tree) {
+	if(tree == NULL) {
+		return(BTREE_ERR_NULL_ARG);
+	}
+	if(tree->_root != NULL) {
+		_destroyNode(tree, tree->_root);
+	}
+	free(tree->_scratch);
+	tree->_root = NULL;
+	tree->_firstLeaf = NULL;
+	tree->_scratch = NULL;
+	tree->_size = 0;
+
+	return(BTREE_FUNC_SUCCESS);
+}
+
+long BTree_size(const BTree* tree) {
+	if(tree == NULL) {
+		return(BTREE_ERR_NULL_ARG);
+	}
+	return(tree->_size);
+}
+
+int BTree_insert(BTree* tree, const void* key, const void* value) {
+	if(tree == NULL || key == NULL || (value == NULL && tree->_valueSize > 0) ) {
+		return(BTREE_ERR_NULL_ARG);
+	}
+	struct _BTreeStep path[_MAX_HEIGHT];
+	int depth;
+	struct _BTreeNode* leaf = _descend(tree, key, path, &depth);
+	int index = _lowerBound(tree, leaf, key);
+
+	if(index < leaf->count && _compare(tree, _key(tree, leaf, index), key) == 0) {
+		if(tree->_valueDestructor != NULL) {
+			tree->_valueDestructor(_value(tree, leaf, index) );
+		}
+		if(tree->_valueSize > 0) {
+			memcpy(_value(tree, leaf, index), value, tree->_valueSize);
+		}
+		return(BTREE_FUNC_SUCCESS);
+	}
+	if(leaf->count < tree->_leafCapacity) {
+		_leafInsertAt(tree, leaf, index, key, value);
+		tree->_size++;
+		return(BTREE_FUNC_SUCCESS);
+	}
+	//  The leaf splits, and so does every full node above it. Allocate all of the new
+	//  nodes first, so that running out of memory leaves the tree untouched.
+	struct _BTreeNode* fresh[_MAX_HEIGHT + 1];
+	int level = depth - 1;
+	int needed = 1;
+
+	while(level >= 0 && path[level].node->count == tree->_innerCapacity) {
+		level--;
+		needed++;
+	}
+	needed += (level < 0);	// A new root.
+	for(int i = 0; i < needed; i++) {
+		fresh[i] = _allocNode(tree, i == 0);
+		if(fresh[i] == NULL) {
+			_freeNodes(fresh, i);
+			return(BTREE_ERR_ALLOCATION);
+		}
+	}
+	int used = 0;
+	struct _BTreeNode* child = fresh[used++];
+
+	_splitLeaf(tree, leaf, child, index, key, value);
+	for(level = depth - 1; level >= 0 && child != NULL; level--) {
+		struct _BTreeNode* node = path[level].node;
+
+		if(node->count < tree->_innerCapacity) {
+			_innerInsertAt(tree, node, path[level].index, tree->_scratch, child);
+			child = NULL;
+		}
+		else {
+			struct _BTreeNode* right = fresh[used++];
+
+			_splitInner(tree, node, right, path[level].index, child);
+			child = right;
+		}
+	}
+	if(child != NULL) {
+		struct _BTreeNode* root = fresh[used++];
+
+		_children(tree, root)[0] = tree->_root;
+		_innerInsertAt(tree, root, 0, tree->_scratch, child);
+		tree->_root = root;
+	}
+	tree->_size++;
+
+	return(BTREE_FUNC_SUCCESS);
+}
+
+int BTree_erase(BTree* tree, const void* key) {
+	if(tree == NULL || key == NULL) {
+		return(BTREE_ERR_NULL_ARG);
+	}
+	struct _BTreeStep path[_MAX_HEIGHT];
+	int depth;
+	struct _BTreeNode* leaf = _descend(tree, key, path, &depth);
+	int index = _lowerBound(tree, leaf, key);
+
+	if(index == leaf->count || _compare(tree, _key(tree, leaf, index), key) != 0) {
+		return(BTREE_ITEM_NOT_FOUND);
+	}
+	if(tree->_valueDestructor != NULL) {
+		tree->_valueDestructor(_value(tree, leaf, index) );
+	}
+	_moveKeys(tree, leaf, index, leaf, index + 1, leaf->count - index - 1);
+	_moveValues(tree, leaf, index, leaf, index + 1, leaf->count - index - 1);
+	leaf->count--;
+	tree->_size--;
+
+	//  Separators above still bound the keys correctly, so only underfull nodes need
+	//  attention, bottom-up.
+	struct _BTreeNode* node = leaf;
+
+	for(int level = depth - 1; level >= 0 && node->count < _minimum(tree, node); level--) {
+		_rebalance(tree, path[level].node, path[level].index);
+		node = path[level].node;
+	}
+	if(!tree->_root->leaf && tree->_root->count == 0) {
+		struct _BTreeNode* root = tree->_root;
+
+		tree->_root = _children(tree, root)[0];
+		free(root);
+	}
+	return(BTREE_FUNC_SUCCESS);
+}
+
+void* BTree_find(const BTree* tree, const void* key) {
+	if(tree == NULL || key == NULL) {
+		return(NULL);
+	}
+	struct _BTreeNode* leaf = _descend(tree, key, NULL, NULL);
+	int index = _lowerBound(tree, leaf, key);
+
+	if(index == leaf->count || _compare(tree, _key(tree, leaf, index), key) != 0) {
+		return(NULL);
+	}
+	return(_value(tree, leaf, index) );
+}
+
+int BTree_range(const BTree* tree, const void* lowKey, const void* highKey, int (*callback)(const void*, void*, void*), void* context) {
+	if(tree == NULL || callback == NULL) {
+		return(BTREE_ERR_NULL_ARG);
+	}
+	struct _BTreeNode* leaf = tree->_firstLeaf;
+	int index = 0;
+
+	if(lowKey != NULL) {
+		leaf = _descend(tree, lowKey, NULL, NULL);
+		index = _lowerBound(tree, leaf, lowKey);
+	}
+	for( ; leaf != NULL; leaf = leaf->next, index = 0) {
+		//  Fetch the next leaf while this one is scanned.
+		__builtin_prefetch(leaf->next);
+		int end = leaf->count;
+
+		//  Only the last leaf of the range needs its end searched for.
+		if(highKey != NULL && end > 0 && _compare(tree, _key(tree, leaf, end - 1), highKey) >= 0) {
+			end = _lowerBound(tree, leaf, highKey);
+		}
+		for(int i = index; i < end; i++) {
+			int returnVal = callback(_key(tree, leaf, i), _value(tree, leaf, i), context);
+
+			if(returnVal != 0) {
+				return(returnVal);
+			}
+		}
+		if(end < leaf->count) {
+			break;
+		}
+	}
+	return(BTREE_FUNC_SUCCESS);
+}
+
+int BTree_iteratorBegin(const BTree* tree, BTreeIterator* iterator) {
+	if(tree == NULL || iterator == NULL) {
+		return(BTREE_ERR_NULL_ARG);
+	}
+	iterator->_tree = tree;
+	iterator->_node = tree->_firstLeaf;
+	iterator->_index = 0;
+
+	return( (tree->_size == 0) ? BTREE_END : BTREE_FUNC_SUCCESS);
+}
+
+int BTree_iteratorSeek(const BTree* tree, const void* key, BTreeIterator* iterator) {
+	if(tree == NULL || key == NULL || iterator == NULL) {
+		return(BTREE_ERR_NULL_ARG);
+	}
+	iterator->_tree = tree;
+	iterator->_node = _descend(tree, key, NULL, NULL);
+	iterator->_index = _lowerBound(tree, iterator->_node, key);
+
+	//  The first key not less than key may start the next leaf.
+	if(iterator->_index == iterator->_node->count) {
+		if(iterator->_node->next == NULL) {
+			return(BTREE_END);
+		}
+		iterator->_node = iterator->_node->next;
+		iterator->_index = 0;
+	}
+	return(BTREE_FUNC_SUCCESS);
+}
+
+int BTree_iteratorNext(BTreeIterator* iterator) {
+	if(iterator == NULL) {
+		return(BTREE_ERR_NULL_ARG);
+	}
+	if(iterator->_index >= iterator->_node->count) {
+		return(BTREE_END);
+	}
+	iterator->_index++;
+	if(iterator->_index == iterator->_node->count && iterator->_node->next != NULL) {
+		iterator->_node = iterator->_node->next;
+		iterator->_index = 0;
+	}
+	return( (iterator->_index == iterator->_node->count) ? BTREE_END : BTREE_FUNC_SUCCESS);
+}
+
+void* BTree_iteratorKey(const BTreeIterator* iterator) {
+	if(iterator == NULL || iterator->_index >= iterator->_node->count) {
+		return(NULL);
+	}
+	return(_key(iterator->_tree, iterator->_node, iterator->_index) );
+}
+
+void* BTree_iteratorValue(const BTreeIterator* iterator) {
+	if(iterator == NULL || iterator->_index >= iterator->_node->count) {
+		return(NULL);
+	}
+	return(_value(iterator->_tree, iterator->_node, iterator->_index) );
+}
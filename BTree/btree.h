@@ -0,0 +1,230 @@
+#ifndef _BTREE_H_
+#define _BTREE_H_
+
+#include "../Vector/vector.h"
+
+/////////////////////////////////////////////////////////////////////////////////////////
+//  BTree function return values
+/////////////////////////////////////////////////////////////////////////////////////////
+#define BTREE_ITEM_NOT_FOUND	 2	// Key not found during a find or erase
+#define BTREE_END				 1	// Iterator has moved past the last key
+#define BTREE_FUNC_SUCCESS		 0	// No error
+#define BTREE_ERR_NULL_ARG		-1	// Required pointer argument is NULL
+#define BTREE_ERR_INVALID_ARG	-2	// An invalid value has been passed to function
+#define BTREE_ERR_ALLOCATION	-3	// Node allocation has failed
+
+/////////////////////////////////////////////////////////////////////////////////////////
+//  Target size of a node in bytes. The number of keys per node is derived from it, with
+//  a minimum of BTREE_MIN_CAPACITY, and nodes are allocated on cache line boundaries.
+/////////////////////////////////////////////////////////////////////////////////////////
+#define BTREE_NODE_SIZE		512
+#define BTREE_MIN_CAPACITY	4
+
+/////////////////////////////////////////////////////////////////////////////////////////
+//  _BTreeNode is the header of a tree node. Keys follow the header contiguously, then
+//  the values (leaves) or child pointers (inner nodes). This data structure will be
+//  managed within the BTree_... functions and does not require client interaction.
+/////////////////////////////////////////////////////////////////////////////////////////
+struct _BTreeNode
+{
+	int count;					// Number of keys.
+	int leaf;
+	struct _BTreeNode* next;	// Neighbouring leaves, in key order; NULL in inner nodes.
+	struct _BTreeNode* prev;
+};
+
+/////////////////////////////////////////////////////////////////////////////////////////
+//  BTree is the client-side data structure for an ordered map from fixed-size keys to
+//  fixed-size values, stored in a B+tree. Every key and value lives in the leaves,
+//  which are linked so ranges are scanned leaf by leaf; inner nodes only hold copies of
+//  keys to route searches. Nodes are sized to a few cache lines, so a lookup touches
+//  about one node per level. The members within BTree will be managed with the
+//  BTree_... functions and do not require client interaction.
+//  Member - _root:				Root node; a leaf while the tree fits in one.
+//  Member - _firstLeaf:		Leftmost leaf.
+//  Member - _size:				Number of keys.
+//  Member - _keySize:			Size, in bytes, of each key.
+//  Member - _valueSize:		Size, in bytes, of each value; may be 0 for an ordered set.
+//  Member - _leafCapacity:		Most keys in a leaf.
+//  Member - _innerCapacity:	Most keys in an inner node, which has one more child.
+//  Member - _valuesOffset:		Offset of the values from the start of a leaf.
+//  Member - _childrenOffset:	Offset of the child pointers from the start of an inner node.
+//  Member - _leafBytes:		Allocation size of a leaf.
+//  Member - _innerBytes:		Allocation size of an inner node.
+//  Member - _scratch:			Room for two keys, passed up when nodes split.
+//  Member - _keyCompare:		Client-side compare function; negative, zero or positive as
+//								the first key orders before, equal to or after the second.
+//  Member - _valueDestructor:	Function pointer to client-side value destructor.
+/////////////////////////////////////////////////////////////////////////////////////////
+typedef struct _BTree {
+	struct _BTreeNode* _root;
+	struct _BTreeNode* _firstLeaf;
+	long _size;
+	int _keySize;
+	int _valueSize;
+	int _leafCapacity;
+	int _innerCapacity;
+	int _valuesOffset;
+	int _childrenOffset;
+	int _leafBytes;
+	int _innerBytes;
+	void* _scratch;
+	int (*_keyCompare)(void*, void*);
+	int (*_valueDestructor)(void*);
+} BTree;
+
+/////////////////////////////////////////////////////////////////////////////////////////
+//  BTreeIterator is a position in a BTree, from which keys can be read in order. It is
+//  invalidated by any insert or erase.
+/////////////////////////////////////////////////////////////////////////////////////////
+typedef struct _BTreeIterator {
+	const BTree* _tree;
+	struct _BTreeNode* _node;
+	int _index;
+} BTreeIterator;
+
+/////////////////////////////////////////////////////////////////////////////////////////
+//  Initializes an empty tree.
+//
+//  Arg - tree:				Pointer to the tree which is being created.
+//  Arg - keySize:			Size, in bytes, of each key. Keys are copied into inner nodes
+//							and never destroyed, so they should not own memory.
+//  Arg - valueSize:		Size, in bytes, of each value, or 0 for an ordered set.
+//  Arg - keyCompare:		Client-side compare function, as memcmp.
+//  Arg - valueDestructor:	Function pointer to client-side value destructor. It is
+//							passed a pointer to the value within the tree.
+//
+//  Returns: BTREE_... #defined above.
+/////////////////////////////////////////////////////////////////////////////////////////
+int BTree_create(BTree* tree, int keySize, int valueSize, int (*keyCompare)(void*, void*), int (*valueDestructor)(void*));
+
+/////////////////////////////////////////////////////////////////////////////////////////
+//  Initializes a tree from sorted keys and their values in O(n), filling leaves and
+//  inner nodes level by level without any search or split.
+//
+//  Arg - tree:				Pointer to the tree which is being created.
+//  Arg - keys:				Vector of keys, strictly ascending by keyCompare.
+//  Arg - values:			Vector of values, one per key, or NULL for an ordered set.
+//  Arg - keyCompare:		Client-side compare function, as memcmp.
+//  Arg - valueDestructor:	Function pointer to client-side value destructor.
+//
+//  Returns: BTREE_... #defined above. BTREE_ERR_INVALID_ARG is returned if the vectors
+//			 differ in size or the keys are not strictly ascending.
+//
+//  Note: Values are copied bitwise, so the tree takes over whatever they own; values
+//		  should then be destroyed without an element destructor.
+/////////////////////////////////////////////////////////////////////////////////////////
+int BTree_fromVectors(BTree* tree, const Vector* keys, const Vector* values, int (*keyCompare)(void*, void*), int (*valueDestructor)(void*));
+
+/////////////////////////////////////////////////////////////////////////////////////////
+//  Calls the destructor on every value and frees every node.
+//
+//  Arg - tree: Pointer to the tree which is being destroyed.
+//
+//  Returns: BTREE_... #defined above.
+/////////////////////////////////////////////////////////////////////////////////////////
+int BTree_destroy(BTree* tree);
+
+/////////////////////////////////////////////////////////////////////////////////////////
+//  Returns number of keys in tree.
+//
+//  Arg - tree: Pointer to the tree.
+//
+//  Returns: Number of keys.
+/////////////////////////////////////////////////////////////////////////////////////////
+long BTree_size(const BTree* tree);
+
+/////////////////////////////////////////////////////////////////////////////////////////
+//  Copies key and value into the tree in O(log n). If the key is already present its
+//  value is destroyed and replaced.
+//
+//  Arg - tree:	 Pointer to the tree.
+//  Arg - key:	 Pointer to the key to copy.
+//  Arg - value: Pointer to the value to copy; ignored for an ordered set.
+//
+//  Returns: BTREE_... #defined above.
+/////////////////////////////////////////////////////////////////////////////////////////
+int BTree_insert(BTree* tree, const void* key, const void* value);
+
+/////////////////////////////////////////////////////////////////////////////////////////
+//  Destroys the value of key and removes the key in O(log n), merging or rebalancing
+//  nodes left less than half full.
+//
+//  Arg - tree:	Pointer to the tree.
+//  Arg - key:	Pointer to the key to remove.
+//
+//  Returns: BTREE_... #defined above.
+/////////////////////////////////////////////////////////////////////////////////////////
+int BTree_erase(BTree* tree, const void* key);
+
+/////////////////////////////////////////////////////////////////////////////////////////
+//  Looks up key in O(log n).
+//
+//  Arg - tree:	Pointer to the tree.
+//  Arg - key:	Pointer to the key to find.
+//
+//  Returns: Pointer to the value within the tree, or NULL if key is not present.
+//
+//  Note: The pointer is invalidated by any insert or erase.
+/////////////////////////////////////////////////////////////////////////////////////////
+void* BTree_find(const BTree* tree, const void* key);
+
+/////////////////////////////////////////////////////////////////////////////////////////
+//  Calls callback on each key in [lowKey, highKey) in order, walking the leaf chain and
+//  prefetching the next leaf while the current one is scanned.
+//
+//  Arg - tree:		Pointer to the tree.
+//  Arg - lowKey:	First key of the range, or NULL to start at the smallest key.
+//  Arg - highKey:	Key ending the range, or NULL to run to the largest key.
+//  Arg - callback:	Called with each key, its value and context. A non-zero return value
+//					stops the scan.
+//  Arg - context:	Client pointer passed through to callback.
+//
+//  Returns: BTREE_... #defined above, or the non-zero value returned by callback if it
+//			 stopped the scan.
+//
+//  Note: callback must not insert or erase.
+/////////////////////////////////////////////////////////////////////////////////////////
+int BTree_range(const BTree* tree, const void* lowKey, const void* highKey, int (*callback)(const void*, void*, void*), void* context);
+
+/////////////////////////////////////////////////////////////////////////////////////////
+//  Positions iterator at the smallest key.
+//
+//  Arg - tree:		Pointer to the tree.
+//  Arg - iterator:	Pointer to the iterator to position.
+//
+//  Returns: BTREE_... #defined above. BTREE_END if tree is empty.
+/////////////////////////////////////////////////////////////////////////////////////////
+int BTree_iteratorBegin(const BTree* tree, BTreeIterator* iterator);
+
+/////////////////////////////////////////////////////////////////////////////////////////
+//  Positions iterator at the first key not less than key.
+//
+//  Arg - tree:		Pointer to the tree.
+//  Arg - key:		Pointer to the key to seek.
+//  Arg - iterator:	Pointer to the iterator to position.
+//
+//  Returns: BTREE_... #defined above. BTREE_END if every key is less than key.
+/////////////////////////////////////////////////////////////////////////////////////////
+int BTree_iteratorSeek(const BTree* tree, const void* key, BTreeIterator* iterator);
+
+/////////////////////////////////////////////////////////////////////////////////////////
+//  Advances iterator to the next key.
+//
+//  Arg - iterator: Pointer to the iterator.
+//
+//  Returns: BTREE_... #defined above. BTREE_END once past the largest key.
+/////////////////////////////////////////////////////////////////////////////////////////
+int BTree_iteratorNext(BTreeIterator* iterator);
+
+/////////////////////////////////////////////////////////////////////////////////////////
+//  Returns pointer to the key, or value, at iterator.
+//
+//  Arg - iterator: Pointer to the iterator.
+//
+//  Returns: Pointer within the tree, or NULL if iterator is past the end.
+/////////////////////////////////////////////////////////////////////////////////////////
+void* BTree_iteratorKey(const BTreeIterator* iterator);
+void* BTree_iteratorValue(const BTreeIterator* iterator);
+
+#endif
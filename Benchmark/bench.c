@@ -0,0 +1,218 @@
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+
+#include "../List/list.h"
+#include "../Vector/vector.h"
+
+/////////////////////////////////////////////////////////////////////////////////////////
+//  Benchmarks the Vector and LinkedList hot paths across element sizes and counts.
+//  One result row is printed per (container, operation, element size, count), as CSV
+//  by default or as JSON lines with --json. Operations whose cost per call grows with
+//  count (insert-middle, remove-front, find-by-key) are timed over at most BENCH_OPS
+//  calls so the largest counts stay tractable; ns_per_op is comparable either way.
+//
+//  Usage: atl_bench [--json] [--max-count N]
+/////////////////////////////////////////////////////////////////////////////////////////
+#define BENCH_OPS			1000
+#define BENCH_FINDS			100
+#define BENCH_MAX_COUNT		1000000
+
+static const int elementSizes[] = {8, 64, 256};
+
+static int jsonOutput = 0;
+static volatile long sink;
+
+static long long _nowNs(void) {
+	struct timespec now;
+
+	clock_gettime(CLOCK_MONOTONIC, &now);
+	return( (long long) now.tv_sec * 1000000000LL + now.tv_nsec);
+}
+
+static void _report(const char* container, const char* operation, int elementSize, long count, long ops, long long ns) {
+	if(jsonOutput) {
+		printf("{\"library\":\"atl\",\"container\":\"%s\",\"operation\":\"%s\",\"element_size\":%d,"
+		       "\"count\":%ld,\"ops\":%ld,\"ns_total\":%lld,\"ns_per_op\":%.3f}\n",
+		       container, operation, elementSize, count, ops, ns, ops > 0 ? (double) ns / ops : 0.0);
+	}
+	else {
+		printf("atl,%s,%s,%d,%ld,%ld,%lld,%.3f\n",
+		       container, operation, elementSize, count, ops, ns, ops > 0 ? (double) ns / ops : 0.0);
+	}
+	fflush(stdout);
+}
+
+static void _fillElement(void* element, int elementSize, long key) {
+	memset(element, (int) (key & 0x7f), elementSize);
+	memcpy(element, &key, sizeof(long) );
+}
+
+static int _freeElement(void* element) {
+	free(element);
+	return(0);
+}
+
+static int _compareKey(void* first, void* second) {
+	return( (*(long*) first == *(long*) second) ? 0 : 1);
+}
+
+static void _benchVector(int elementSize, long count) {
+	Vector vector;
+	void* element = malloc(elementSize);
+	long ops = count < BENCH_OPS ? count : BENCH_OPS;
+	long finds = count < BENCH_FINDS ? count : BENCH_FINDS;
+	long long start;
+
+	// append
+	Vector_create(&vector, 1, elementSize, NULL);
+	start = _nowNs();
+	for(long i = 0; i < count; i++) {
+		_fillElement(element, elementSize, i);
+		Vector_append(&vector, element);
+	}
+	_report("vector", "append", elementSize, count, count, _nowNs() - start);
+
+	// iterate
+	start = _nowNs();
+	long sum = 0;
+	for(long i = 0; i < count; i++) {
+		sum += *(long*) Vector_get(&vector, i);
+	}
+	sink = sum;
+	_report("vector", "iterate", elementSize, count, count, _nowNs() - start);
+
+	// find-by-key
+	start = _nowNs();
+	for(long f = 0; f < finds; f++) {
+		long key = (f * 7919) % count;
+		for(long i = 0; i < count; i++) {
+			if(*(long*) Vector_get(&vector, i) == key) {
+				sink = i;
+				break;
+			}
+		}
+	}
+	_report("vector", "find-by-key", elementSize, count, finds, _nowNs() - start);
+
+	// insert-middle
+	start = _nowNs();
+	for(long i = 0; i < ops; i++) {
+		_fillElement(element, elementSize, -i);
+		Vector_insert(&vector, element, Vector_size(&vector) / 2);
+	}
+	_report("vector", "insert-middle", elementSize, count, ops, _nowNs() - start);
+
+	// remove-front
+	start = _nowNs();
+	for(long i = 0; i < ops; i++) {
+		Vector_remove(&vector, 0);
+	}
+	_report("vector", "remove-front", elementSize, count, ops, _nowNs() - start);
+
+	// destroy
+	start = _nowNs();
+	Vector_destroy(&vector);
+	_report("vector", "destroy", elementSize, count, count, _nowNs() - start);
+
+	// resize
+	_fillElement(element, elementSize, 0);
+	Vector_create(&vector, 1, elementSize, NULL);
+	start = _nowNs();
+	Vector_resize(&vector, element, count);
+	_report("vector", "resize", elementSize, count, count, _nowNs() - start);
+	Vector_destroy(&vector);
+
+	free(element);
+}
+
+static void _benchList(int elementSize, long count) {
+	LinkedList list;
+	long ops = count < BENCH_OPS ? count : BENCH_OPS;
+	long finds = count < BENCH_FINDS ? count : BENCH_FINDS;
+	long long start;
+	void* element;
+
+	// append
+	List_create(&list, _freeElement);
+	start = _nowNs();
+	for(long i = 0; i < count; i++) {
+		element = malloc(elementSize);
+		_fillElement(element, elementSize, i);
+		List_append(&list, element);
+	}
+	_report("list", "append", elementSize, count, count, _nowNs() - start);
+
+	// iterate
+	start = _nowNs();
+	long sum = 0;
+	for(element = List_iteratorBegin(&list); element != NULL; element = List_iteratorNext(&list) ) {
+		sum += *(long*) element;
+	}
+	sink = sum;
+	_report("list", "iterate", elementSize, count, count, _nowNs() - start);
+
+	// find-by-key
+	start = _nowNs();
+	for(long f = 0; f < finds; f++) {
+		long key = (f * 7919) % count;
+		List_iteratorBegin(&list);
+		List_iteratorTo(&list, &key, _compareKey);
+	}
+	_report("list", "find-by-key", elementSize, count, finds, _nowNs() - start);
+
+	// insert-middle (locating the middle is part of the cost, as it is for clients)
+	start = _nowNs();
+	for(long i = 0; i < ops; i++) {
+		long middle = (count + i) / 2;
+
+		List_iteratorBegin(&list);
+		for(long j = 0; j < middle; j++) {
+			List_iteratorNext(&list);
+		}
+		element = malloc(elementSize);
+		_fillElement(element, elementSize, -i);
+		List_iteratorInsert(&list, element);
+	}
+	_report("list", "insert-middle", elementSize, count, ops, _nowNs() - start);
+
+	// remove-front
+	start = _nowNs();
+	for(long i = 0; i < ops; i++) {
+		List_behead(&list);
+	}
+	_report("list", "remove-front", elementSize, count, ops, _nowNs() - start);
+
+	// destroy
+	start = _nowNs();
+	List_destroy(&list);
+	_report("list", "destroy", elementSize, count, count, _nowNs() - start);
+}
+
+int main (int argc, char *argv[]) {
+	long maxCount = BENCH_MAX_COUNT;
+
+	for(int i = 1; i < argc; i++) {
+		if(strcmp(argv[i], "--json") == 0) {
+			jsonOutput = 1;
+		}
+		else if(strcmp(argv[i], "--max-count") == 0 && i + 1 < argc) {
+			maxCount = atol(argv[++i]);
+		}
+		else {
+			fprintf(stderr, "Usage: %s [--json] [--max-count N]\n", argv[0]);
+			return(1);
+		}
+	}
+	if(!jsonOutput) {
+		printf("library,container,operation,element_size,count,ops,ns_total,ns_per_op\n");
+	}
+	for(unsigned int s = 0; s < sizeof(elementSizes) / sizeof(elementSizes[0]); s++) {
+		for(long count = 10; count <= maxCount; count *= 10) {
+			_benchVector(elementSizes[s], count);
+			_benchList(elementSizes[s], count);
+		}
+	}
+	return(0);
+}
@@ -0,0 +1,194 @@
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <iterator>
+#include <list>
+#include <vector>
+
+/////////////////////////////////////////////////////////////////////////////////////////
+//  std::vector / std::list baselines for Benchmark/bench.c. Runs the same operations
+//  with the same counts and element sizes and prints rows in the same format, with
+//  library "std", so the two outputs can be concatenated and compared directly.
+//
+//  Usage: atl_bench_std [--json] [--max-count N]
+/////////////////////////////////////////////////////////////////////////////////////////
+#define BENCH_OPS			1000
+#define BENCH_FINDS			100
+#define BENCH_MAX_COUNT		1000000
+
+static bool jsonOutput = false;
+static volatile long sink;
+
+template<int Size>
+struct Record {
+	unsigned char bytes[Size];
+
+	explicit Record(long key = 0) {
+		memset(bytes, (int) (key & 0x7f), Size);
+		memcpy(bytes, &key, sizeof(long) );
+	}
+	long key() const {
+		long key;
+		memcpy(&key, bytes, sizeof(long) );
+		return(key);
+	}
+};
+
+static long long _nowNs() {
+	return(std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now().time_since_epoch() ).count() );
+}
+
+static void _report(const char* container, const char* operation, int elementSize, long count, long ops, long long ns) {
+	if(jsonOutput) {
+		printf("{\"library\":\"std\",\"container\":\"%s\",\"operation\":\"%s\",\"element_size\":%d,"
+		       "\"count\":%ld,\"ops\":%ld,\"ns_total\":%lld,\"ns_per_op\":%.3f}\n",
+		       container, operation, elementSize, count, ops, ns, ops > 0 ? (double) ns / ops : 0.0);
+	}
+	else {
+		printf("std,%s,%s,%d,%ld,%ld,%lld,%.3f\n",
+		       container, operation, elementSize, count, ops, ns, ops > 0 ? (double) ns / ops : 0.0);
+	}
+	fflush(stdout);
+}
+
+template<int Size>
+static void _benchVector(long count) {
+	long ops = count < BENCH_OPS ? count : BENCH_OPS;
+	long finds = count < BENCH_FINDS ? count : BENCH_FINDS;
+	long long start;
+	auto* vector = new std::vector<Record<Size> >();
+
+	start = _nowNs();
+	for(long i = 0; i < count; i++) {
+		vector->push_back(Record<Size>(i) );
+	}
+	_report("vector", "append", Size, count, count, _nowNs() - start);
+
+	start = _nowNs();
+	long sum = 0;
+	for(const Record<Size>& record : *vector) {
+		sum += record.key();
+	}
+	sink = sum;
+	_report("vector", "iterate", Size, count, count, _nowNs() - start);
+
+	start = _nowNs();
+	for(long f = 0; f < finds; f++) {
+		long key = (f * 7919) % count;
+		for(long i = 0; i < (long) vector->size(); i++) {
+			if( (*vector)[i].key() == key) {
+				sink = i;
+				break;
+			}
+		}
+	}
+	_report("vector", "find-by-key", Size, count, finds, _nowNs() - start);
+
+	start = _nowNs();
+	for(long i = 0; i < ops; i++) {
+		vector->insert(vector->begin() + (vector->size() / 2), Record<Size>(-i) );
+	}
+	_report("vector", "insert-middle", Size, count, ops, _nowNs() - start);
+
+	start = _nowNs();
+	for(long i = 0; i < ops; i++) {
+		vector->erase(vector->begin() );
+	}
+	_report("vector", "remove-front", Size, count, ops, _nowNs() - start);
+
+	start = _nowNs();
+	delete vector;
+	_report("vector", "destroy", Size, count, count, _nowNs() - start);
+
+	vector = new std::vector<Record<Size> >(1);
+	start = _nowNs();
+	vector->resize(count, Record<Size>(0) );
+	_report("vector", "resize", Size, count, count, _nowNs() - start);
+	delete vector;
+}
+
+template<int Size>
+static void _benchList(long count) {
+	long ops = count < BENCH_OPS ? count : BENCH_OPS;
+	long finds = count < BENCH_FINDS ? count : BENCH_FINDS;
+	long long start;
+	auto* list = new std::list<Record<Size> >();
+
+	start = _nowNs();
+	for(long i = 0; i < count; i++) {
+		list->push_back(Record<Size>(i) );
+	}
+	_report("list", "append", Size, count, count, _nowNs() - start);
+
+	start = _nowNs();
+	long sum = 0;
+	for(const Record<Size>& record : *list) {
+		sum += record.key();
+	}
+	sink = sum;
+	_report("list", "iterate", Size, count, count, _nowNs() - start);
+
+	start = _nowNs();
+	for(long f = 0; f < finds; f++) {
+		long key = (f * 7919) % count;
+		for(const Record<Size>& record : *list) {
+			if(record.key() == key) {
+				sink = key;
+				break;
+			}
+		}
+	}
+	_report("list", "find-by-key", Size, count, finds, _nowNs() - start);
+
+	start = _nowNs();
+	for(long i = 0; i < ops; i++) {
+		auto middle = list->begin();
+		std::advance(middle, (count + i) / 2);
+		list->insert(middle, Record<Size>(-i) );
+	}
+	_report("list", "insert-middle", Size, count, ops, _nowNs() - start);
+
+	start = _nowNs();
+	for(long i = 0; i < ops; i++) {
+		list->pop_front();
+	}
+	_report("list", "remove-front", Size, count, ops, _nowNs() - start);
+
+	start = _nowNs();
+	delete list;
+	_report("list", "destroy", Size, count, count, _nowNs() - start);
+}
+
+template<int Size>
+static void _benchSize(long maxCount) {
+	for(long count = 10; count <= maxCount; count *= 10) {
+		_benchVector<Size>(count);
+		_benchList<Size>(count);
+	}
+}
+
+int main(int argc, char* argv[]) {
+	long maxCount = BENCH_MAX_COUNT;
+
+	for(int i = 1; i < argc; i++) {
+		if(strcmp(argv[i], "--json") == 0) {
+			jsonOutput = true;
+		}
+		else if(strcmp(argv[i], "--max-count") == 0 && i + 1 < argc) {
+			maxCount = atol(argv[++i]);
+		}
+		else {
+			fprintf(stderr, "Usage: %s [--json] [--max-count N]\n", argv[0]);
+			return(1);
+		}
+	}
+	if(!jsonOutput) {
+		printf("library,container,operation,element_size,count,ops,ns_total,ns_per_op\n");
+	}
+	_benchSize<8>(maxCount);
+	_benchSize<64>(maxCount);
+	_benchSize<256>(maxCount);
+
+	return(0);
+}
@@ -0,0 +1,248 @@
+#include <string.h>
+#include "bitvector.h"
+
+static unsigned long* _words(const BitVector* bits) {
+	return( (unsigned long*) Vector_array(&bits->_words) );
+}
+
+static long _wordCount(long size) {
+	return( (size + BITVECTOR_WORD_BITS - 1) / BITVECTOR_WORD_BITS);
+}
+
+//  Clears the bits past the size in the last word, which every operation relies on.
+static void _clearTail(BitVector* bits) {
+	long tail = bits->_size % BITVECTOR_WORD_BITS;
+
+	if(tail != 0) {
+		_words(bits)[bits->_size / BITVECTOR_WORD_BITS] &= (1UL << tail) - 1;
+	}
+}
+
+//  Sets bits [from, to), filling whole words with memset.
+static void _setRange(BitVector* bits, long from, long to) {
+	unsigned long* words = _words(bits);
+
+	for(; from < to && from % BITVECTOR_WORD_BITS != 0; from++) {
+		words[from / BITVECTOR_WORD_BITS] |= 1UL << (from % BITVECTOR_WORD_BITS);
+	}
+	long fullWords = (to - from) / BITVECTOR_WORD_BITS;
+
+	memset(&words[from / BITVECTOR_WORD_BITS], 0xff, fullWords * sizeof(unsigned long) );
+	for(from += fullWords * BITVECTOR_WORD_BITS; from < to; from++) {
+		words[from / BITVECTOR_WORD_BITS] |= 1UL << (from % BITVECTOR_WORD_BITS);
+	}
+}
+
+int BitVector_create(BitVector* bits, long capacity) {
+	if(bits == NULL) {
+		return(BITVECTOR_ERR_NULL_ARG);
+	}
+	if(capacity < 1) {
+		return(BITVECTOR_ERR_INVALID_ARG);
+	}
+	int returnVal = Vector_create(&bits->_words, _wordCount(capacity), sizeof(unsigned long), NULL);
+
+	if(returnVal != VECTOR_FUNC_SUCCESS) {
+		return(returnVal);
+	}
+	bits->_size = 0;
+
+	return(BITVECTOR_FUNC_SUCCESS);
+}
+
+int BitVector_destroy(BitVector* bits) {
+	if(bits == NULL) {
+		return(BITVECTOR_ERR_NULL_ARG);
+	}
+	Vector_destroy(&bits->_words);
+	bits->_size = 0;
+
+	return(BITVECTOR_FUNC_SUCCESS);
+}
+
+long BitVector_size(const BitVector* bits) {
+	if(bits == NULL) {
+		return(BITVECTOR_ERR_NULL_ARG);
+	}
+	return(bits->_size);
+}
+
+int BitVector_resize(BitVector* bits, long size, int value) {
+	if(bits == NULL) {
+		return(BITVECTOR_ERR_NULL_ARG);
+	}
+	if(size < 0) {
+		return(BITVECTOR_ERR_INVALID_ARG);
+	}
+	long wordCount = _wordCount(size);
+	long oldWordCount = Vector_size(&bits->_words);
+
+	if(size < bits->_size) {
+		Vector_truncate(&bits->_words, wordCount);	// Zeroes the dropped words.
+		bits->_size = size;
+		_clearTail(bits);
+		return(BITVECTOR_FUNC_SUCCESS);
+	}
+	//  New words come from zeroed capacity, and the old tail bits are already clear.
+	if(wordCount > oldWordCount && Vector_emplaceN(&bits->_words, oldWordCount, wordCount - oldWordCount) == NULL) {
+		return(BITVECTOR_ERR_ALLOCATION);
+	}
+	long oldSize = bits->_size;
+
+	bits->_size = size;
+	if(value) {
+		_setRange(bits, oldSize, size);
+	}
+	return(BITVECTOR_FUNC_SUCCESS);
+}
+
+int BitVector_get(const BitVector* bits, long index) {
+	if(bits == NULL) {
+		return(BITVECTOR_ERR_NULL_ARG);
+	}
+	if(index < 0 || index >= bits->_size) {
+		return(BITVECTOR_ERR_OUT_OF_BOUNDS);
+	}
+	return( (_words(bits)[index / BITVECTOR_WORD_BITS] >> (index % BITVECTOR_WORD_BITS) ) & 1);
+}
+
+int BitVector_set(BitVector* bits, long index, int value) {
+	if(bits == NULL) {
+		return(BITVECTOR_ERR_NULL_ARG);
+	}
+	if(index < 0 || index >= bits->_size) {
+		return(BITVECTOR_ERR_OUT_OF_BOUNDS);
+	}
+	unsigned long* word = &_words(bits)[index / BITVECTOR_WORD_BITS];
+	unsigned long mask = 1UL << (index % BITVECTOR_WORD_BITS);
+
+	*word = value ? (*word | mask) : (*word & ~mask);
+
+	return(BITVECTOR_FUNC_SUCCESS);
+}
+
+int BitVector_append(BitVector* bits, int value) {
+	if(bits == NULL) {
+		return(BITVECTOR_ERR_NULL_ARG);
+	}
+	if(bits->_size % BITVECTOR_WORD_BITS == 0 && Vector_emplaceBack(&bits->_words) == NULL) {
+		return(BITVECTOR_ERR_ALLOCATION);
+	}
+	bits->_size++;
+
+	return(value ? BitVector_set(bits, bits->_size - 1, 1) : BITVECTOR_FUNC_SUCCESS);
+}
+
+long BitVector_count(const BitVector* bits) {
+	if(bits == NULL) {
+		return(BITVECTOR_ERR_NULL_ARG);
+	}
+	const unsigned long* words = _words(bits);
+	long wordCount = Vector_size(&bits->_words);
+	long count = 0;
+
+	for(long i = 0; i < wordCount; i++) {
+		count += __builtin_popcountl(words[i]);
+	}
+	return(count);
+}
+
+long BitVector_findNext(const BitVector* bits, long index) {
+	if(bits == NULL) {
+		return(BITVECTOR_ERR_NULL_ARG);
+	}
+	if(index < 0) {
+		return(BITVECTOR_ERR_INVALID_ARG);
+	}
+	if(index >= bits->_size) {
+		return(bits->_size);
+	}
+	const unsigned long* words = _words(bits);
+	long wordCount = Vector_size(&bits->_words);
+	long i = index / BITVECTOR_WORD_BITS;
+	unsigned long word = words[i] & (~0UL << (index % BITVECTOR_WORD_BITS) );
+
+	while(word == 0) {
+		if(++i == wordCount) {
+			return(bits->_size);
+		}
+		word = words[i];
+	}
+	return(i * BITVECTOR_WORD_BITS + __builtin_ctzl(word) );
+}
+
+long BitVector_findFirst(const BitVector* bits) {
+	return(BitVector_findNext(bits, 0) );
+}
+
+//  Checks the operands of a set operation and returns their word arrays.
+static int _operands(BitVector* bits, const BitVector* other, unsigned long** words, const unsigned long** otherWords) {
+	if(bits == NULL || other == NULL) {
+		return(BITVECTOR_ERR_NULL_ARG);
+	}
+	if(bits->_size != other->_size) {
+		return(BITVECTOR_ERR_INVALID_ARG);
+	}
+	*words = _words(bits);
+	*otherWords = _words(other);
+
+	return(BITVECTOR_FUNC_SUCCESS);
+}
+
+//  The loops below are simple enough for the compiler to vectorize. The tail bits of
+//  both operands are clear, so none of the operations can set them.
+int BitVector_and(BitVector* bits, const BitVector* other) {
+	unsigned long* words;
+	const unsigned long* otherWords;
+	int returnVal = _operands(bits, other, &words, &otherWords);
+
+	if(returnVal != BITVECTOR_FUNC_SUCCESS) {
+		return(returnVal);
+	}
+	for(long i = 0, wordCount = Vector_size(&bits->_words); i < wordCount; i++) {
+		words[i] &= otherWords[i];
+	}
+	return(BITVECTOR_FUNC_SUCCESS);
+}
+
+int BitVector_or(BitVector* bits, const BitVector* other) {
+	unsigned long* words;
+	const unsigned long* otherWords;
+	int returnVal = _operands(bits, other, &words, &otherWords);
+
+	if(returnVal != BITVECTOR_FUNC_SUCCESS) {
+		return(returnVal);
+	}
+	for(long i = 0, wordCount = Vector_size(&bits->_words); i < wordCount; i++) {
+		words[i] |= otherWords[i];
+	}
+	return(BITVECTOR_FUNC_SUCCESS);
+}
+
+int BitVector_xor(BitVector* bits, const BitVector* other) {
+	unsigned long* words;
+	const unsigned long* otherWords;
+	int returnVal = _operands(bits, other, &words, &otherWords);
+
+	if(returnVal != BITVECTOR_FUNC_SUCCESS) {
+		return(returnVal);
+	}
+	for(long i = 0, wordCount = Vector_size(&bits->_words); i < wordCount; i++) {
+		words[i] ^= otherWords[i];
+	}
+	return(BITVECTOR_FUNC_SUCCESS);
+}
+
+int BitVector_andNot(BitVector* bits, const BitVector* other) {
+	unsigned long* words;
+	const unsigned long* otherWords;
+	int returnVal = _operands(bits, other, &words, &otherWords);
+
+	if(returnVal != BITVECTOR_FUNC_SUCCESS) {
+		return(returnVal);
+	}
+	for(long i = 0, wordCount = Vector_size(&bits->_words); i < wordCount; i++) {
+		words[i] &= ~otherWords[i];
+	}
+	return(BITVECTOR_FUNC_SUCCESS);
+}
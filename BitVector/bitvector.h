@@ -0,0 +1,152 @@
+#ifndef _BITVECTOR_H_
+#define _BITVECTOR_H_
+
+#include "../Vector/vector.h"
+
+/////////////////////////////////////////////////////////////////////////////////////////
+//  BitVector function return values
+/////////////////////////////////////////////////////////////////////////////////////////
+#define BITVECTOR_FUNC_SUCCESS		 0	// No error
+#define BITVECTOR_ERR_NULL_ARG		-1	// Required pointer argument is NULL
+#define BITVECTOR_ERR_INVALID_ARG	-2	// An invalid value has been passed to function
+#define BITVECTOR_ERR_ALLOCATION	-3	// Word capacity resize has failed
+#define BITVECTOR_ERR_OUT_OF_BOUNDS	-4	// Attempted to access an index out of bounds
+
+/////////////////////////////////////////////////////////////////////////////////////////
+//  Bits are packed least significant bit first into words of this many bits.
+/////////////////////////////////////////////////////////////////////////////////////////
+#define BITVECTOR_WORD_BITS	(8 * (long) sizeof(unsigned long) )
+
+/////////////////////////////////////////////////////////////////////////////////////////
+//  BitVector is the client-side data structure for a vector of bits, packed into
+//  machine words so that counting, searching and set operations work a whole word at
+//  a time. Bits past the size in the last word are always kept zero. The members
+//  within BitVector will be managed with the BitVector_... functions and do not
+//  require client interaction.
+//  Member - _words:	Vector of unsigned long holding the bits.
+//  Member - _size:		Number of bits.
+/////////////////////////////////////////////////////////////////////////////////////////
+typedef struct _BitVector {
+	Vector _words;
+	long _size;
+} BitVector;
+
+/////////////////////////////////////////////////////////////////////////////////////////
+//  Initializes and allocates memory for bit vector.
+//
+//  Arg - bits:		Pointer to the bit vector which is being created.
+//  Arg - capacity:	Desired initial capacity, in bits.
+//
+//  Returns: BITVECTOR_... #defined above.
+/////////////////////////////////////////////////////////////////////////////////////////
+int BitVector_create(BitVector* bits, long capacity);
+
+/////////////////////////////////////////////////////////////////////////////////////////
+//  Frees the words of bit vector.
+//
+//  Arg - bits: Pointer to the bit vector which is being destroyed.
+//
+//  Returns: BITVECTOR_... #defined above.
+/////////////////////////////////////////////////////////////////////////////////////////
+int BitVector_destroy(BitVector* bits);
+
+/////////////////////////////////////////////////////////////////////////////////////////
+//  Returns number of bits in bit vector.
+//
+//  Arg - bits: Pointer to the bit vector.
+//
+//  Returns: Number of bits.
+/////////////////////////////////////////////////////////////////////////////////////////
+long BitVector_size(const BitVector* bits);
+
+/////////////////////////////////////////////////////////////////////////////////////////
+//  Grows or shrinks bit vector to size bits.
+//
+//  Arg - bits:  Pointer to the bit vector which is being resized.
+//  Arg - size:  Desired number of bits.
+//  Arg - value: Value (0 or 1) of the bits added when growing.
+//
+//  Returns: BITVECTOR_... #defined above.
+/////////////////////////////////////////////////////////////////////////////////////////
+int BitVector_resize(BitVector* bits, long size, int value);
+
+/////////////////////////////////////////////////////////////////////////////////////////
+//  Returns bit at index (after an in-bounds check).
+//
+//  Arg - bits:  Pointer to the bit vector.
+//  Arg - index: Bit to fetch.
+//
+//  Returns: 0 or 1, or BITVECTOR_... #defined above on error.
+/////////////////////////////////////////////////////////////////////////////////////////
+int BitVector_get(const BitVector* bits, long index);
+
+/////////////////////////////////////////////////////////////////////////////////////////
+//  Sets bit at index (after an in-bounds check).
+//
+//  Arg - bits:  Pointer to the bit vector.
+//  Arg - index: Bit to set.
+//  Arg - value: 0 clears the bit, anything else sets it.
+//
+//  Returns: BITVECTOR_... #defined above.
+/////////////////////////////////////////////////////////////////////////////////////////
+int BitVector_set(BitVector* bits, long index, int value);
+
+/////////////////////////////////////////////////////////////////////////////////////////
+//  Appends a bit to the end of bit vector.
+//
+//  Arg - bits:  Pointer to the bit vector.
+//  Arg - value: 0 appends a clear bit, anything else a set bit.
+//
+//  Returns: BITVECTOR_... #defined above.
+/////////////////////////////////////////////////////////////////////////////////////////
+int BitVector_append(BitVector* bits, int value);
+
+/////////////////////////////////////////////////////////////////////////////////////////
+//  Counts set bits with one popcount per word.
+//
+//  Arg - bits: Pointer to the bit vector.
+//
+//  Returns: Number of set bits, or BITVECTOR_... #defined above on error.
+/////////////////////////////////////////////////////////////////////////////////////////
+long BitVector_count(const BitVector* bits);
+
+/////////////////////////////////////////////////////////////////////////////////////////
+//  Finds the first set bit at or after index, skipping clear words whole.
+//
+//  Arg - bits:  Pointer to the bit vector.
+//  Arg - index: Bit to start from.
+//
+//  Returns: Index of the set bit, or the bit vector size if there is none; or
+//           BITVECTOR_... #defined above on error.
+//
+//  Note: Set bits can be visited with
+//        for(i = BitVector_findNext(bits, 0); i < size; i = BitVector_findNext(bits, i + 1))
+/////////////////////////////////////////////////////////////////////////////////////////
+long BitVector_findNext(const BitVector* bits, long index);
+
+/////////////////////////////////////////////////////////////////////////////////////////
+//  Finds the first set bit.
+//
+//  Arg - bits: Pointer to the bit vector.
+//
+//  Returns: As BitVector_findNext from index 0.
+/////////////////////////////////////////////////////////////////////////////////////////
+long BitVector_findFirst(const BitVector* bits);
+
+/////////////////////////////////////////////////////////////////////////////////////////
+//  Word-parallel set operations, storing into bits the result of bits op other:
+//  and (intersection), or (union), xor (symmetric difference) and andNot (bits with
+//  the bits of other removed).
+//
+//  Arg - bits:	 Pointer to the bit vector which receives the result.
+//  Arg - other: Pointer to the second operand. May be the same as bits.
+//
+//  Returns: BITVECTOR_... #defined above. BITVECTOR_ERR_INVALID_ARG is returned if the
+//           sizes differ.
+/////////////////////////////////////////////////////////////////////////////////////////
+int BitVector_and(BitVector* bits, const BitVector* other);
+int BitVector_or(BitVector* bits, const BitVector* other);
+int BitVector_xor(BitVector* bits, const BitVector* other);
+int BitVector_andNot(BitVector* bits, const BitVector* other);
+
+#endif
@@ -0,0 +1,129 @@
+#include "blobvector.h"
+
+int BlobVector_create(BlobVector* blobs, long byteCapacity, long countCapacity) {
+	if(blobs == NULL) {
+		return(BLOBVECTOR_ERR_NULL_ARG);
+	}
+	if(byteCapacity < 1 || countCapacity < 1) {
+		return(BLOBVECTOR_ERR_INVALID_ARG);
+	}
+	long zero = 0;
+
+	Vector_create(&blobs->_arena, byteCapacity, sizeof(char), NULL);
+	Vector_create(&blobs->_offsets, countCapacity + 1, sizeof(long), NULL);
+
+	if(Vector_array(&blobs->_arena) == NULL || Vector_append(&blobs->_offsets, &zero) != VECTOR_FUNC_SUCCESS) {
+		BlobVector_destroy(blobs);
+		return(BLOBVECTOR_ERR_ALLOCATION);
+	}
+	return(BLOBVECTOR_FUNC_SUCCESS);
+}
+
+int BlobVector_destroy(BlobVector* blobs) {
+	if(blobs == NULL) {
+		return(BLOBVECTOR_ERR_NULL_ARG);
+	}
+	Vector_destroy(&blobs->_arena);
+	Vector_destroy(&blobs->_offsets);
+
+	return(BLOBVECTOR_FUNC_SUCCESS);
+}
+
+long BlobVector_size(const BlobVector* blobs) {
+	if(blobs == NULL) {
+		return(BLOBVECTOR_ERR_NULL_ARG);
+	}
+	return(Vector_size(&blobs->_offsets) - 1);
+}
+
+long BlobVector_bytes(const BlobVector* blobs) {
+	if(blobs == NULL) {
+		return(BLOBVECTOR_ERR_NULL_ARG);
+	}
+	return(Vector_size(&blobs->_arena) );
+}
+
+void* BlobVector_get(const BlobVector* blobs, long index, long* length) {
+	if(blobs == NULL) {
+		return(NULL);
+	}
+	if(index < 0 || index >= Vector_size(&blobs->_offsets) - 1) {
+		return(NULL);
+	}
+	long* offsets = (long*) Vector_array(&blobs->_offsets);
+
+	if(length != NULL) {
+		*length = offsets[index + 1] - offsets[index];
+	}
+	return(Vector_array(&blobs->_arena) + offsets[index]);
+}
+
+long BlobVector_length(const BlobVector* blobs, long index) {
+	if(blobs == NULL) {
+		return(BLOBVECTOR_ERR_NULL_ARG);
+	}
+	if(index < 0 || index >= Vector_size(&blobs->_offsets) - 1) {
+		return(BLOBVECTOR_ERR_OUT_OF_BOUNDS);
+	}
+	long* offsets = (long*) Vector_array(&blobs->_offsets);
+
+	return(offsets[index + 1] - offsets[index]);
+}
+
+int BlobVector_append(BlobVector* blobs, const void* data, long length) {
+	if(blobs == NULL || (data == NULL && length > 0) ) {
+		return(BLOBVECTOR_ERR_NULL_ARG);
+	}
+	if(length < 0) {
+		return(BLOBVECTOR_ERR_INVALID_ARG);
+	}
+	void* payload = BlobVector_emplace(blobs, length);
+
+	if(payload == NULL) {
+		return(BLOBVECTOR_ERR_ALLOCATION);
+	}
+	memcpy(payload, data, length);
+
+	return(BLOBVECTOR_FUNC_SUCCESS);
+}
+
+void* BlobVector_emplace(BlobVector* blobs, long length) {
+	if(blobs == NULL || length < 0) {
+		return(NULL);
+	}
+	long arenaSize = Vector_size(&blobs->_arena);
+	long end = arenaSize + length;
+	void* payload;
+
+	// Reserve the offset slot first so a failed arena grow leaves nothing to undo.
+	if(Vector_append(&blobs->_offsets, &end) != VECTOR_FUNC_SUCCESS) {
+		return(NULL);
+	}
+	if(length == 0) {
+		return(Vector_array(&blobs->_arena) + arenaSize);
+	}
+	payload = Vector_emplaceN(&blobs->_arena, arenaSize, length);
+	if(payload == NULL) {
+		Vector_chop(&blobs->_offsets);
+	}
+	return(payload);
+}
+
+int BlobVector_truncate(BlobVector* blobs, long size) {
+	if(blobs == NULL) {
+		return(BLOBVECTOR_ERR_NULL_ARG);
+	}
+	if(size < 0 || size > Vector_size(&blobs->_offsets) - 1) {
+		return(BLOBVECTOR_ERR_OUT_OF_BOUNDS);
+	}
+	long* offsets = (long*) Vector_array(&blobs->_offsets);
+
+	Vector_truncate(&blobs->_arena, offsets[size]);
+	Vector_truncate(&blobs->_offsets, size + 1);
+
+	return(BLOBVECTOR_FUNC_SUCCESS);
+}
+
+int BlobVector_clear(BlobVector* blobs) {
+	return(BlobVector_truncate(blobs, 0) );
+}
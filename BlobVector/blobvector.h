@@ -0,0 +1,135 @@
+#ifndef _BLOBVECTOR_H_
+#define _BLOBVECTOR_H_
+
+#include "../Vector/vector.h"
+
+/////////////////////////////////////////////////////////////////////////////////////////
+//  BlobVector function return values
+/////////////////////////////////////////////////////////////////////////////////////////
+#define BLOBVECTOR_FUNC_SUCCESS			 0	// No error
+#define BLOBVECTOR_ERR_NULL_ARG			-1	// Required pointer argument is NULL
+#define BLOBVECTOR_ERR_INVALID_ARG		-2	// An invalid value has been passed to function
+#define BLOBVECTOR_ERR_ALLOCATION		-3	// Arena or offset capacity resize has failed
+#define BLOBVECTOR_ERR_OUT_OF_BOUNDS	-4	// Attempted to access an index out of bounds
+
+/////////////////////////////////////////////////////////////////////////////////////////
+//  BlobVector is the client-side data structure for a vector of variable-length
+//  elements ("blobs"). Blob payloads are stored back to back in a single byte arena,
+//  and an offsets array gives O(1) access to any blob by index. The members within
+//  BlobVector will be managed with the BlobVector_... functions and do not require
+//  client interaction.
+//  Member - _arena:	Vector of bytes holding every blob payload contiguously.
+//  Member - _offsets:	Vector of long holding the arena offset of each blob, plus one
+//						trailing entry holding the arena size, so blob i spans
+//						[_offsets[i], _offsets[i + 1]).
+/////////////////////////////////////////////////////////////////////////////////////////
+typedef struct _BlobVector {
+	Vector _arena;
+	Vector _offsets;
+} BlobVector;
+
+/////////////////////////////////////////////////////////////////////////////////////////
+//  Initializes and allocates memory for blob vector.
+//
+//  Arg - blobs:		 Pointer to the blob vector which is being created.
+//  Arg - byteCapacity:	 Desired initial arena capacity, in bytes.
+//  Arg - countCapacity: Desired initial capacity, in blobs.
+//
+//  Returns: BLOBVECTOR_... #defined above.
+/////////////////////////////////////////////////////////////////////////////////////////
+int BlobVector_create(BlobVector* blobs, long byteCapacity, long countCapacity);
+
+/////////////////////////////////////////////////////////////////////////////////////////
+//  Frees the arena and offsets of blob vector. Blobs are plain bytes, so no
+//  per-element destructor is involved.
+//
+//  Arg - blobs: Pointer to the blob vector which is being destroyed.
+//
+//  Returns: BLOBVECTOR_... #defined above.
+/////////////////////////////////////////////////////////////////////////////////////////
+int BlobVector_destroy(BlobVector* blobs);
+
+/////////////////////////////////////////////////////////////////////////////////////////
+//  Returns number of blobs in blob vector.
+//
+//  Arg - blobs: Pointer to the blob vector.
+//
+//  Returns: Number of blobs.
+/////////////////////////////////////////////////////////////////////////////////////////
+long BlobVector_size(const BlobVector* blobs);
+
+/////////////////////////////////////////////////////////////////////////////////////////
+//  Returns number of payload bytes stored in blob vector.
+//
+//  Arg - blobs: Pointer to the blob vector.
+//
+//  Returns: Total size, in bytes, of all blobs.
+/////////////////////////////////////////////////////////////////////////////////////////
+long BlobVector_bytes(const BlobVector* blobs);
+
+/////////////////////////////////////////////////////////////////////////////////////////
+//  Returns pointer to blob at index (after an in-bounds check).
+//
+//  Arg - blobs:  Pointer to the blob vector.
+//  Arg - index:  Blob to fetch.
+//  Arg - length: If not NULL, receives the length of the blob in bytes.
+//
+//  Returns: Pointer to blob payload, or NULL if index is out of bounds.
+//
+//  Note: Payloads are packed without padding, so the pointer has no alignment
+//		  guarantee. It is invalidated by any call which grows the arena.
+/////////////////////////////////////////////////////////////////////////////////////////
+void* BlobVector_get(const BlobVector* blobs, long index, long* length);
+
+/////////////////////////////////////////////////////////////////////////////////////////
+//  Returns length of blob at index.
+//
+//  Arg - blobs: Pointer to the blob vector.
+//  Arg - index: Blob whose length to fetch.
+//
+//  Returns: Length of blob in bytes, or BLOBVECTOR_ERR_OUT_OF_BOUNDS.
+/////////////////////////////////////////////////////////////////////////////////////////
+long BlobVector_length(const BlobVector* blobs, long index);
+
+/////////////////////////////////////////////////////////////////////////////////////////
+//  Appends a copy of length bytes of data as a new blob at the end of blob vector.
+//
+//  Arg - blobs:  Pointer to the blob vector which will be appended.
+//  Arg - data:	  Payload to copy. May be NULL only if length is 0.
+//  Arg - length: Length of payload in bytes.
+//
+//  Returns: BLOBVECTOR_... #defined above.
+/////////////////////////////////////////////////////////////////////////////////////////
+int BlobVector_append(BlobVector* blobs, const void* data, long length);
+
+/////////////////////////////////////////////////////////////////////////////////////////
+//  Appends a new blob of length bytes and returns a pointer to its payload so the
+//  caller can write it in place.
+//
+//  Arg - blobs:  Pointer to the blob vector which will be appended.
+//  Arg - length: Length of the new blob in bytes.
+//
+//  Returns: Pointer to the new blob payload, or NULL on error.
+/////////////////////////////////////////////////////////////////////////////////////////
+void* BlobVector_emplace(BlobVector* blobs, long length);
+
+/////////////////////////////////////////////////////////////////////////////////////////
+//  Removes all blobs from index size onward, releasing their arena space for reuse.
+//
+//  Arg - blobs: Pointer to the blob vector being truncated.
+//  Arg - size:	 New number of blobs (0 to size, inclusive).
+//
+//  Returns: BLOBVECTOR_... #defined above.
+/////////////////////////////////////////////////////////////////////////////////////////
+int BlobVector_truncate(BlobVector* blobs, long size);
+
+/////////////////////////////////////////////////////////////////////////////////////////
+//  Removes every blob in one step. Arena and offset capacity are kept for reuse.
+//
+//  Arg - blobs: Pointer to the blob vector being cleared.
+//
+//  Returns: BLOBVECTOR_... #defined above.
+/////////////////////////////////////////////////////////////////////////////////////////
+int BlobVector_clear(BlobVector* blobs);
+
+#endif
@@ -0,0 +1,73 @@
+#include "blobvector.h"
+
+BlobVector employeeNames;
+
+int addEmployee() {
+	char input[256];
+	char name[256];
+
+	printf("Name:  ");
+	fgets(input, sizeof(input) - 1, stdin);
+	sscanf(input, "%255s", name);
+
+	// Only strlen(name) + 1 bytes of arena are used instead of a fixed 256 byte slot.
+	BlobVector_append(&employeeNames, name, strlen(name) + 1);
+
+	return(1);
+}
+
+int deleteLastEmployee() {
+	if(BlobVector_size(&employeeNames) == 0) {
+		printf("No employees!\n\n");
+		return(0);
+	}
+	BlobVector_truncate(&employeeNames, BlobVector_size(&employeeNames) - 1);
+
+	return(1);
+}
+
+int listEmployees() {
+	for(long i = 0; i < BlobVector_size(&employeeNames); i++) {
+		printf(" * %s(%ld)\n", (char*) BlobVector_get(&employeeNames, i, NULL), i);
+	}
+
+	return(0);
+}
+
+int main (int argc, char *argv[]) {
+	char input[10];
+	char choice;
+
+	BlobVector_create(&employeeNames, 64, 4);
+
+	while(1) {
+		printf("Employee Names (%ld, %ld bytes):\n\n", BlobVector_size(&employeeNames), BlobVector_bytes(&employeeNames) );
+		printf("[A]dd employee\n");
+		printf("[D]elete last employee\n");
+		printf("[C]lear employees\n");
+		printf("[L]ist employee(s)\n");
+		printf("[Q]uit\n\n:");
+
+		fgets(input, sizeof(input) - 1, stdin);
+		sscanf(input, "%c", &choice);
+
+		switch(input[0]) {
+			case 'a':
+				addEmployee();
+				break;
+			case 'd':
+				deleteLastEmployee();
+				break;
+			case 'c':
+				BlobVector_clear(&employeeNames);
+				break;
+			case 'l':
+				listEmployees();
+				break;
+			case 'q':
+				BlobVector_destroy(&employeeNames);
+				return(0);
+		}
+	}
+	return(0);
+}
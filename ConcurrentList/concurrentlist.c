@@ -0,0 +1,269 @@
+#include <stdlib.h>
+#include "concurrentlist.h"
+
+//  Finds the first node not ordered before probe (curr, NULL at the end of the list)
+//  and the node preceding it (pred). Takes no locks.
+static void _locate(ConcurrentList* list, void* probe, struct _ConcurrentNode** pred, struct _ConcurrentNode** curr) {
+	*pred = &list->_head;
+	*curr = atomic_load(&(*pred)->next);
+
+	while(*curr != NULL && list->_elementCompare((*curr)->data, probe) < 0) {
+		*pred = *curr;
+		*curr = atomic_load(&(*curr)->next);
+	}
+}
+
+static void _lock(struct _ConcurrentNode* pred, struct _ConcurrentNode* curr) {
+	pthread_mutex_lock(&pred->lock);	// Always in list order, so no lock cycles.
+	if(curr != NULL) {
+		pthread_mutex_lock(&curr->lock);
+	}
+}
+
+static void _unlock(struct _ConcurrentNode* pred, struct _ConcurrentNode* curr) {
+	if(curr != NULL) {
+		pthread_mutex_unlock(&curr->lock);
+	}
+	pthread_mutex_unlock(&pred->lock);
+}
+
+//  With pred and curr locked, checks that neither has been removed and that they are
+//  still adjacent.
+static int _validate(struct _ConcurrentNode* pred, struct _ConcurrentNode* curr) {
+	return(!atomic_load(&pred->marked) && (curr == NULL || !atomic_load(&curr->marked) ) &&
+	       atomic_load(&pred->next) == curr);
+}
+
+static void _freeNode(ConcurrentList* list, struct _ConcurrentNode* node) {
+	if(list->_elementDestructor != NULL) {
+		list->_elementDestructor(node->data);
+	}
+	pthread_mutex_destroy(&node->lock);
+	free(node);
+}
+
+//  Queues an unlinked node for reclamation, and reclaims the queue if it is full.
+//  Must be called outside of a read section.
+static void _retire(ConcurrentList* list, struct _ConcurrentNode* node) {
+	struct _ConcurrentNode* retired = NULL;
+
+	pthread_mutex_lock(&list->_retireLock);
+	node->nextRetired = list->_retired;
+	list->_retired = node;
+	if(++list->_retiredCount >= CONCURRENTLIST_RETIRE_BATCH) {
+		retired = list->_retired;
+		list->_retired = NULL;
+		list->_retiredCount = 0;
+	}
+	pthread_mutex_unlock(&list->_retireLock);
+
+	if(retired == NULL) {
+		return;
+	}
+	pthread_mutex_lock(&list->_reclaimLock);
+	Epoch_synchronize(&list->_epoch);	// Every thread that could reach the nodes has left.
+	pthread_mutex_unlock(&list->_reclaimLock);
+
+	while(retired != NULL) {
+		struct _ConcurrentNode* next = retired->nextRetired;
+
+		_freeNode(list, retired);
+		retired = next;
+	}
+}
+
+int ConcurrentList_create(ConcurrentList* list, int (*elementCompare)(void*, void*), int (*elementDestructor)(void*)) {
+	if(list == NULL || elementCompare == NULL) {
+		return(CONCURRENTLIST_ERR_NULL_ARG);
+	}
+	atomic_init(&list->_head.next, NULL);
+	atomic_init(&list->_head.marked, 0);
+	list->_head.data = NULL;
+	pthread_mutex_init(&list->_head.lock, NULL);
+	atomic_init(&list->_size, 0);
+	Epoch_create(&list->_epoch);
+	list->_retired = NULL;
+	list->_retiredCount = 0;
+	pthread_mutex_init(&list->_retireLock, NULL);
+	pthread_mutex_init(&list->_reclaimLock, NULL);
+	list->_elementCompare = elementCompare;
+	list->_elementDestructor = elementDestructor;
+
+	return(CONCURRENTLIST_FUNC_SUCCESS);
+}
+
+int ConcurrentList_destroy(ConcurrentList* list) {
+	if(list == NULL) {
+		return(CONCURRENTLIST_ERR_NULL_ARG);
+	}
+	struct _ConcurrentNode* node = atomic_load(&list->_head.next);
+
+	while(node != NULL) {
+		struct _ConcurrentNode* next = atomic_load(&node->next);
+
+		_freeNode(list, node);
+		node = next;
+	}
+	node = list->_retired;
+	while(node != NULL) {
+		struct _ConcurrentNode* next = node->nextRetired;
+
+		_freeNode(list, node);
+		node = next;
+	}
+	atomic_store(&list->_head.next, NULL);
+	atomic_store(&list->_size, 0);
+	list->_retired = NULL;
+	list->_retiredCount = 0;
+	pthread_mutex_destroy(&list->_head.lock);
+	pthread_mutex_destroy(&list->_retireLock);
+	pthread_mutex_destroy(&list->_reclaimLock);
+
+	return(CONCURRENTLIST_FUNC_SUCCESS);
+}
+
+long ConcurrentList_size(ConcurrentList* list) {
+	if(list == NULL) {
+		return(CONCURRENTLIST_ERR_NULL_ARG);
+	}
+	return(atomic_load(&list->_size) );
+}
+
+int ConcurrentList_insert(ConcurrentList* list, void* data) {
+	if(list == NULL || data == NULL) {
+		return(CONCURRENTLIST_ERR_NULL_ARG);
+	}
+	struct _ConcurrentNode* pred;
+	struct _ConcurrentNode* curr;
+	struct _ConcurrentNode* node = (struct _ConcurrentNode*) malloc(sizeof(struct _ConcurrentNode) );
+
+	if(node == NULL) {
+		return(CONCURRENTLIST_ERR_ALLOCATION);
+	}
+	node->data = data;
+	atomic_init(&node->marked, 0);
+	pthread_mutex_init(&node->lock, NULL);
+
+	long token = ConcurrentList_enter(list);
+	int returnVal;
+
+	while(1) {
+		_locate(list, data, &pred, &curr);
+		_lock(pred, curr);
+		if(_validate(pred, curr) ) {
+			break;
+		}
+		_unlock(pred, curr);	// Raced with a concurrent change; start over.
+	}
+	if(curr != NULL && list->_elementCompare(curr->data, data) == 0) {
+		returnVal = CONCURRENTLIST_ITEM_EXISTS;
+	}
+	else {
+		atomic_init(&node->next, curr);
+		atomic_store(&pred->next, node);
+		atomic_fetch_add(&list->_size, 1);
+		returnVal = CONCURRENTLIST_FUNC_SUCCESS;
+	}
+	_unlock(pred, curr);
+	ConcurrentList_exit(list, token);
+
+	if(returnVal != CONCURRENTLIST_FUNC_SUCCESS) {
+		pthread_mutex_destroy(&node->lock);
+		free(node);
+	}
+	return(returnVal);
+}
+
+int ConcurrentList_remove(ConcurrentList* list, void* probe) {
+	if(list == NULL || probe == NULL) {
+		return(CONCURRENTLIST_ERR_NULL_ARG);
+	}
+	struct _ConcurrentNode* pred;
+	struct _ConcurrentNode* curr;
+	long token = ConcurrentList_enter(list);
+
+	while(1) {
+		_locate(list, probe, &pred, &curr);
+		_lock(pred, curr);
+		if(_validate(pred, curr) ) {
+			break;
+		}
+		_unlock(pred, curr);
+	}
+	if(curr == NULL || list->_elementCompare(curr->data, probe) != 0) {
+		_unlock(pred, curr);
+		ConcurrentList_exit(list, token);
+		return(CONCURRENTLIST_ITEM_NOT_FOUND);
+	}
+	atomic_store(&curr->marked, 1);		// Logical removal first...
+	atomic_store(&pred->next, atomic_load(&curr->next) );	// ...then physical.
+	atomic_fetch_sub(&list->_size, 1);
+	_unlock(pred, curr);
+	ConcurrentList_exit(list, token);
+
+	_retire(list, curr);
+
+	return(CONCURRENTLIST_FUNC_SUCCESS);
+}
+
+int ConcurrentList_contains(ConcurrentList* list, void* probe) {
+	if(list == NULL || probe == NULL) {
+		return(CONCURRENTLIST_ERR_NULL_ARG);
+	}
+	long token = ConcurrentList_enter(list);
+	int returnVal = (ConcurrentList_find(list, probe) != NULL) ? CONCURRENTLIST_FUNC_SUCCESS : CONCURRENTLIST_ITEM_NOT_FOUND;
+
+	ConcurrentList_exit(list, token);
+
+	return(returnVal);
+}
+
+int ConcurrentList_forEach(ConcurrentList* list, int (*callback)(void*, void*), void* context) {
+	if(list == NULL || callback == NULL) {
+		return(CONCURRENTLIST_ERR_NULL_ARG);
+	}
+	long token = ConcurrentList_enter(list);
+	int returnVal = CONCURRENTLIST_FUNC_SUCCESS;
+
+	for(struct _ConcurrentNode* node = atomic_load(&list->_head.next); node != NULL; node = atomic_load(&node->next) ) {
+		if(!atomic_load(&node->marked) ) {
+			returnVal = callback(node->data, context);
+			if(returnVal != CONCURRENTLIST_FUNC_SUCCESS) {
+				break;
+			}
+		}
+	}
+	ConcurrentList_exit(list, token);
+
+	return(returnVal);
+}
+
+long ConcurrentList_enter(ConcurrentList* list) {
+	if(list == NULL) {
+		return(CONCURRENTLIST_ERR_NULL_ARG);
+	}
+	return(Epoch_enter(&list->_epoch) );
+}
+
+int ConcurrentList_exit(ConcurrentList* list, long token) {
+	if(list == NULL) {
+		return(CONCURRENTLIST_ERR_NULL_ARG);
+	}
+	Epoch_exit(&list->_epoch, token);
+
+	return(CONCURRENTLIST_FUNC_SUCCESS);
+}
+
+void* ConcurrentList_find(ConcurrentList* list, void* probe) {
+	if(list == NULL || probe == NULL) {
+		return(NULL);
+	}
+	struct _ConcurrentNode* pred;
+	struct _ConcurrentNode* curr;
+
+	_locate(list, probe, &pred, &curr);
+	if(curr == NULL || atomic_load(&curr->marked) || list->_elementCompare(curr->data, probe) != 0) {
+		return(NULL);
+	}
+	return(curr->data);
+}
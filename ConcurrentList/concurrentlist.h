@@ -0,0 +1,164 @@
+#ifndef _CONCURRENTLIST_H_
+#define _CONCURRENTLIST_H_
+
+#include <pthread.h>
+#include <stdatomic.h>
+
+#include "../Epoch/epoch.h"
+
+/////////////////////////////////////////////////////////////////////////////////////////
+//  ConcurrentList function return values
+/////////////////////////////////////////////////////////////////////////////////////////
+#define CONCURRENTLIST_ITEM_EXISTS		 3	// A matching item is already in the list
+#define CONCURRENTLIST_ITEM_NOT_FOUND	 2	// Item not found during a search or remove
+#define CONCURRENTLIST_FUNC_SUCCESS		 0	// No error
+#define CONCURRENTLIST_ERR_NULL_ARG		-1	// Required pointer argument is NULL
+#define CONCURRENTLIST_ERR_INVALID_ARG	-2	// An invalid value has been passed to function
+#define CONCURRENTLIST_ERR_ALLOCATION	-3	// Node allocation has failed
+
+/////////////////////////////////////////////////////////////////////////////////////////
+//  Number of removed nodes a thread lets accumulate before it waits for a grace
+//  period and frees them.
+/////////////////////////////////////////////////////////////////////////////////////////
+#define CONCURRENTLIST_RETIRE_BATCH	64
+
+/////////////////////////////////////////////////////////////////////////////////////////
+//  _ConcurrentNode is the internal atom of data used within the concurrent list.
+//  marked is set, under lock, before a node is unlinked, so a lock-free reader which
+//  still reaches the node knows it has been removed. These are managed within the
+//  ConcurrentList_... functions and do not require client interaction.
+/////////////////////////////////////////////////////////////////////////////////////////
+struct _ConcurrentNode
+{
+	struct _ConcurrentNode* _Atomic next;
+	struct _ConcurrentNode* nextRetired;
+	void* data;
+	atomic_int marked;
+	pthread_mutex_t lock;
+};
+
+/////////////////////////////////////////////////////////////////////////////////////////
+//  ConcurrentList is a thread-safe linked list kept sorted by a client compare
+//  function, using lazy synchronization: lookups and traversals take no locks, and
+//  inserts and removes lock only the two nodes around the change, so changes to
+//  disjoint regions of the list proceed in parallel. Removed nodes are freed (and
+//  their element destroyed) only after a grace period in which every reader that
+//  could still hold them has left, tracked with two alternating reader counters.
+//  The members within ConcurrentList will be managed with the ConcurrentList_...
+//  functions and do not require client interaction.
+//  Member - _head:				 Sentinel node before the first element.
+//  Member - _size:				 Number of elements.
+//  Member - _epoch:			 Grace period of threads currently inside the list.
+//  Member - _retired:			 Removed nodes awaiting a grace period.
+//  Member - _retiredCount:		 Number of nodes on _retired.
+//  Member - _retireLock:		 Protects _retired and _retiredCount.
+//  Member - _reclaimLock:		 Serializes grace periods.
+//  Member - _elementCompare:	 Client-side compare function; negative, zero or positive
+//								 as the first element orders before, equal to or after
+//								 the second.
+//  Member - _elementDestructor: Function pointer to client-side element destructor.
+/////////////////////////////////////////////////////////////////////////////////////////
+typedef struct _ConcurrentList
+{
+	struct _ConcurrentNode _head;
+	atomic_long _size;
+	Epoch _epoch;
+	struct _ConcurrentNode* _retired;
+	long _retiredCount;
+	pthread_mutex_t _retireLock;
+	pthread_mutex_t _reclaimLock;
+	int (*_elementCompare)(void*, void*);
+	int (*_elementDestructor)(void*);
+}ConcurrentList;
+
+/////////////////////////////////////////////////////////////////////////////////////////
+//  Initializes an empty concurrent list.
+//  Arg - list: The list to create.
+//  Arg - elementCompare: Orders elements, as memcmp does. Zero means a match.
+//  Arg - elementDestructor: Function pointer to client-side element destructor.
+//  Returns: CONCURRENTLIST_... #defined above.
+/////////////////////////////////////////////////////////////////////////////////////////
+int ConcurrentList_create(ConcurrentList* list, int (*elementCompare)(void*, void*), int (*elementDestructor)(void*));
+
+/////////////////////////////////////////////////////////////////////////////////////////
+//  Destroys every element and frees every node, including those awaiting reclamation.
+//  Arg - list: The list to destroy.
+//  Returns: CONCURRENTLIST_... #defined above.
+//  Note: No other thread may use the list during or after this call.
+/////////////////////////////////////////////////////////////////////////////////////////
+int ConcurrentList_destroy(ConcurrentList* list);
+
+/////////////////////////////////////////////////////////////////////////////////////////
+//  Returns number of elements in list. The value may be stale by the time it is used.
+//  Arg - list: The list.
+//  Returns: Number of elements.
+/////////////////////////////////////////////////////////////////////////////////////////
+long ConcurrentList_size(ConcurrentList* list);
+
+/////////////////////////////////////////////////////////////////////////////////////////
+//  Links data into its sorted position.
+//  Arg - list: The list.
+//  Arg - data: The data to insert. It is the client responsibility to allocate and
+//              initialize data; the list owns it from then on.
+//  Returns: CONCURRENTLIST_... #defined above. CONCURRENTLIST_ITEM_EXISTS is returned,
+//           and data is left to the client, if a matching element is already present.
+/////////////////////////////////////////////////////////////////////////////////////////
+int ConcurrentList_insert(ConcurrentList* list, void* data);
+
+/////////////////////////////////////////////////////////////////////////////////////////
+//  Unlinks the element matching probe. The element is destroyed, and its node freed,
+//  once no reader can still be using it.
+//  Arg - list: The list.
+//  Arg - probe: Element to match, e.g. a stack element with only the key filled in.
+//  Returns: CONCURRENTLIST_... #defined above.
+/////////////////////////////////////////////////////////////////////////////////////////
+int ConcurrentList_remove(ConcurrentList* list, void* probe);
+
+/////////////////////////////////////////////////////////////////////////////////////////
+//  Tests, without taking any lock, whether an element matching probe is present.
+//  Arg - list: The list.
+//  Arg - probe: Element to match.
+//  Returns: CONCURRENTLIST_FUNC_SUCCESS or CONCURRENTLIST_ITEM_NOT_FOUND.
+/////////////////////////////////////////////////////////////////////////////////////////
+int ConcurrentList_contains(ConcurrentList* list, void* probe);
+
+/////////////////////////////////////////////////////////////////////////////////////////
+//  Calls callback, in sorted order and without taking any lock, on each element.
+//  Arg - list: The list.
+//  Arg - callback: Called with each element and context. A non-zero return value
+//              stops the traversal.
+//  Arg - context: Client pointer passed through to callback.
+//  Returns: CONCURRENTLIST_... #defined above, or the non-zero value returned by
+//           callback if it stopped the traversal.
+//  Note: Elements inserted or removed concurrently may or may not be visited.
+/////////////////////////////////////////////////////////////////////////////////////////
+int ConcurrentList_forEach(ConcurrentList* list, int (*callback)(void*, void*), void* context);
+
+/////////////////////////////////////////////////////////////////////////////////////////
+//  Marks the calling thread as reading the list, so no element it finds is destroyed
+//  until the matching ConcurrentList_exit. Sections must be short and must not call
+//  ConcurrentList_insert or ConcurrentList_remove.
+//  Arg - list: The list.
+//  Returns: Token to pass to ConcurrentList_exit, or CONCURRENTLIST_ERR_NULL_ARG.
+/////////////////////////////////////////////////////////////////////////////////////////
+long ConcurrentList_enter(ConcurrentList* list);
+
+/////////////////////////////////////////////////////////////////////////////////////////
+//  Ends a read section started with ConcurrentList_enter.
+//  Arg - list: The list.
+//  Arg - token: Value returned by ConcurrentList_enter.
+//  Returns: CONCURRENTLIST_... #defined above.
+/////////////////////////////////////////////////////////////////////////////////////////
+int ConcurrentList_exit(ConcurrentList* list, long token);
+
+/////////////////////////////////////////////////////////////////////////////////////////
+//  Looks up, without taking any lock, the element matching probe.
+//  Arg - list: The list.
+//  Arg - probe: Element to match.
+//  Returns: Pointer to the element, or NULL if none matches.
+//  Note: Must be called between ConcurrentList_enter and ConcurrentList_exit; the
+//        element pointer is only valid until ConcurrentList_exit.
+/////////////////////////////////////////////////////////////////////////////////////////
+void* ConcurrentList_find(ConcurrentList* list, void* probe);
+
+#endif
@@ -0,0 +1,51 @@
+#include <sched.h>
+#include <stddef.h>
+
+#include "epoch.h"
+
+int Epoch_create(Epoch* epoch) {
+	if(epoch == NULL) {
+		return(EPOCH_ERR_NULL_ARG);
+	}
+	atomic_init(&epoch->_counter, 0);
+	atomic_init(&epoch->_readers[0], 0);
+	atomic_init(&epoch->_readers[1], 0);
+
+	return(EPOCH_FUNC_SUCCESS);
+}
+
+long Epoch_enter(Epoch* epoch) {
+	if(epoch == NULL) {
+		return(EPOCH_ERR_NULL_ARG);
+	}
+	long parity = atomic_load(&epoch->_counter) & 1;
+
+	atomic_fetch_add(&epoch->_readers[parity], 1);
+
+	return(parity);
+}
+
+int Epoch_exit(Epoch* epoch, long token) {
+	if(epoch == NULL) {
+		return(EPOCH_ERR_NULL_ARG);
+	}
+	atomic_fetch_sub(&epoch->_readers[token & 1], 1);
+
+	return(EPOCH_FUNC_SUCCESS);
+}
+
+//  Two flips are needed because a reader may sample the epoch just before a flip and
+//  register on the old parity just after it was found drained.
+int Epoch_synchronize(Epoch* epoch) {
+	if(epoch == NULL) {
+		return(EPOCH_ERR_NULL_ARG);
+	}
+	for(int flip = 0; flip < 2; flip++) {
+		long counter = atomic_fetch_add(&epoch->_counter, 1);
+
+		while(atomic_load(&epoch->_readers[counter & 1]) != 0) {
+			sched_yield();
+		}
+	}
+	return(EPOCH_FUNC_SUCCESS);
+}
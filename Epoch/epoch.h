@@ -0,0 +1,66 @@
+#ifndef _EPOCH_H_
+#define _EPOCH_H_
+
+#include <stdatomic.h>
+
+/////////////////////////////////////////////////////////////////////////////////////////
+//  Epoch function return values
+/////////////////////////////////////////////////////////////////////////////////////////
+#define EPOCH_FUNC_SUCCESS	 0	// No error
+#define EPOCH_ERR_NULL_ARG	-1	// Required pointer argument is NULL
+
+/////////////////////////////////////////////////////////////////////////////////////////
+//  Epoch is the grace period shared by the lock-free readers of SnapshotVector and
+//  ConcurrentList: readers register on one of two counters, selected by the parity of
+//  the epoch, and a writer waits for the counters to drain before reclaiming memory
+//  readers could still reach. It is embedded in those containers and managed by them;
+//  it does not require client interaction.
+//  Member - _counter:	Grace period counter; its low bit selects _readers slot.
+//  Member - _readers:	Readers currently registered, per epoch parity.
+/////////////////////////////////////////////////////////////////////////////////////////
+typedef struct _Epoch {
+	atomic_long _counter;
+	atomic_long _readers[2];
+} Epoch;
+
+/////////////////////////////////////////////////////////////////////////////////////////
+//  Initializes epoch with no registered readers.
+//
+//  Arg - epoch: Pointer to the epoch which is being created.
+//
+//  Returns: EPOCH_... #defined above.
+/////////////////////////////////////////////////////////////////////////////////////////
+int Epoch_create(Epoch* epoch);
+
+/////////////////////////////////////////////////////////////////////////////////////////
+//  Registers the calling thread as a reader until the matching Epoch_exit.
+//
+//  Arg - epoch: Pointer to the epoch.
+//
+//  Returns: Token to pass to Epoch_exit, or EPOCH_ERR_NULL_ARG.
+/////////////////////////////////////////////////////////////////////////////////////////
+long Epoch_enter(Epoch* epoch);
+
+/////////////////////////////////////////////////////////////////////////////////////////
+//  Ends a read section started with Epoch_enter.
+//
+//  Arg - epoch: Pointer to the epoch.
+//  Arg - token: Value returned by Epoch_enter.
+//
+//  Returns: EPOCH_... #defined above.
+/////////////////////////////////////////////////////////////////////////////////////////
+int Epoch_exit(Epoch* epoch, long token);
+
+/////////////////////////////////////////////////////////////////////////////////////////
+//  Waits until every reader registered when called has exited.
+//
+//  Arg - epoch: Pointer to the epoch.
+//
+//  Returns: EPOCH_... #defined above.
+//
+//  Note: Must not be called from within a read section, and concurrent calls must be
+//		  serialized by the caller.
+/////////////////////////////////////////////////////////////////////////////////////////
+int Epoch_synchronize(Epoch* epoch);
+
+#endif
@@ -0,0 +1,185 @@
+#include <stdlib.h>
+#include <string.h>
+#include "gapbuffer.h"
+
+static void* _slot(const GapBuffer* buffer, long slot) {
+	return(buffer->_data + (slot * buffer->_elementSize) );
+}
+
+//  Reallocates to capacity and moves the elements after the gap to the new end, so the
+//  gap absorbs all of the new space.
+static int _grow(GapBuffer* buffer, long capacity) {
+	void* newData = realloc(buffer->_data, capacity * buffer->_elementSize);
+
+	if(newData == NULL) {
+		return(GAPBUFFER_ERR_ALLOCATION);
+	}
+	long afterGap = buffer->_capacity - buffer->_gapEnd;
+
+	buffer->_data = newData;
+	memmove(_slot(buffer, capacity - afterGap), _slot(buffer, buffer->_gapEnd), afterGap * buffer->_elementSize);
+	buffer->_gapEnd = capacity - afterGap;
+	buffer->_capacity = capacity;
+	memset(_slot(buffer, buffer->_gapStart), '\0', (buffer->_gapEnd - buffer->_gapStart) * buffer->_elementSize);
+
+	return(GAPBUFFER_FUNC_SUCCESS);
+}
+
+int GapBuffer_create(GapBuffer* buffer, long capacity, int elementSize, int (*elementDestructor)(void*)) {
+	if(buffer == NULL) {
+		return(GAPBUFFER_ERR_NULL_ARG);
+	}
+	if(capacity < 1 || elementSize < 1) {
+		return(GAPBUFFER_ERR_INVALID_ARG);
+	}
+	buffer->_data = calloc(capacity, elementSize);
+	if(buffer->_data == NULL) {
+		return(GAPBUFFER_ERR_ALLOCATION);
+	}
+	buffer->_capacity = capacity;
+	buffer->_elementSize = elementSize;
+	buffer->_gapStart = 0;
+	buffer->_gapEnd = capacity;
+	buffer->_elementDestructor = elementDestructor;
+
+	return(GAPBUFFER_FUNC_SUCCESS);
+}
+
+int GapBuffer_destroy(GapBuffer* buffer) {
+	if(buffer == NULL) {
+		return(GAPBUFFER_ERR_NULL_ARG);
+	}
+	if(buffer->_elementDestructor != NULL) {
+		for(long i = 0; i < buffer->_gapStart; i++) {
+			buffer->_elementDestructor(_slot(buffer, i) );
+		}
+		for(long i = buffer->_gapEnd; i < buffer->_capacity; i++) {
+			buffer->_elementDestructor(_slot(buffer, i) );
+		}
+	}
+	free(buffer->_data);
+	buffer->_data = NULL;
+	buffer->_capacity = 0;
+	buffer->_gapStart = 0;
+	buffer->_gapEnd = 0;
+
+	return(GAPBUFFER_FUNC_SUCCESS);
+}
+
+long GapBuffer_size(const GapBuffer* buffer) {
+	if(buffer == NULL) {
+		return(GAPBUFFER_ERR_NULL_ARG);
+	}
+	return(buffer->_capacity - (buffer->_gapEnd - buffer->_gapStart) );
+}
+
+long GapBuffer_cursor(const GapBuffer* buffer) {
+	if(buffer == NULL) {
+		return(GAPBUFFER_ERR_NULL_ARG);
+	}
+	return(buffer->_gapStart);
+}
+
+int GapBuffer_moveCursor(GapBuffer* buffer, long position) {
+	if(buffer == NULL) {
+		return(GAPBUFFER_ERR_NULL_ARG);
+	}
+	if(position < 0 || position > GapBuffer_size(buffer) ) {
+		return(GAPBUFFER_ERR_OUT_OF_BOUNDS);
+	}
+	if(position < buffer->_gapStart) {
+		long count = buffer->_gapStart - position;	// Elements moving from before to after the gap.
+
+		memmove(_slot(buffer, buffer->_gapEnd - count), _slot(buffer, position), count * buffer->_elementSize);
+		buffer->_gapStart -= count;
+		buffer->_gapEnd -= count;
+	}
+	else if(position > buffer->_gapStart) {
+		long count = position - buffer->_gapStart;	// Elements moving from after to before the gap.
+
+		memmove(_slot(buffer, buffer->_gapStart), _slot(buffer, buffer->_gapEnd), count * buffer->_elementSize);
+		buffer->_gapStart += count;
+		buffer->_gapEnd += count;
+	}
+	return(GAPBUFFER_FUNC_SUCCESS);
+}
+
+int GapBuffer_insert(GapBuffer* buffer, const void* data) {
+	if(buffer == NULL || data == NULL) {
+		return(GAPBUFFER_ERR_NULL_ARG);
+	}
+	void* slot = GapBuffer_emplace(buffer);
+
+	if(slot == NULL) {
+		return(GAPBUFFER_ERR_ALLOCATION);
+	}
+	memcpy(slot, data, buffer->_elementSize);
+
+	return(GAPBUFFER_FUNC_SUCCESS);
+}
+
+void* GapBuffer_emplace(GapBuffer* buffer) {
+	if(buffer == NULL) {
+		return(NULL);
+	}
+	if(buffer->_gapStart == buffer->_gapEnd && _grow(buffer, buffer->_capacity * GAPBUFFER_CAPACITY_FACTOR) != GAPBUFFER_FUNC_SUCCESS) {
+		return(NULL);
+	}
+	return(_slot(buffer, buffer->_gapStart++) );
+}
+
+int GapBuffer_remove(GapBuffer* buffer) {
+	if(buffer == NULL) {
+		return(GAPBUFFER_ERR_NULL_ARG);
+	}
+	if(buffer->_gapEnd == buffer->_capacity) {
+		return(GAPBUFFER_EMPTY);
+	}
+	if(buffer->_elementDestructor != NULL) {
+		buffer->_elementDestructor(_slot(buffer, buffer->_gapEnd) );
+	}
+	buffer->_gapEnd++;
+
+	return(GAPBUFFER_FUNC_SUCCESS);
+}
+
+int GapBuffer_removeBefore(GapBuffer* buffer) {
+	if(buffer == NULL) {
+		return(GAPBUFFER_ERR_NULL_ARG);
+	}
+	if(buffer->_gapStart == 0) {
+		return(GAPBUFFER_EMPTY);
+	}
+	buffer->_gapStart--;
+	if(buffer->_elementDestructor != NULL) {
+		buffer->_elementDestructor(_slot(buffer, buffer->_gapStart) );
+	}
+	return(GAPBUFFER_FUNC_SUCCESS);
+}
+
+void* GapBuffer_get(const GapBuffer* buffer, long index) {
+	if(buffer == NULL || index < 0 || index >= GapBuffer_size(buffer) ) {
+		return(NULL);
+	}
+	if(index >= buffer->_gapStart) {
+		index += buffer->_gapEnd - buffer->_gapStart;
+	}
+	return(_slot(buffer, index) );
+}
+
+int GapBuffer_set(GapBuffer* buffer, const void* data, long index) {
+	if(buffer == NULL || data == NULL) {
+		return(GAPBUFFER_ERR_NULL_ARG);
+	}
+	void* slot = GapBuffer_get(buffer, index);
+
+	if(slot == NULL) {
+		return(GAPBUFFER_ERR_OUT_OF_BOUNDS);
+	}
+	if(buffer->_elementDestructor != NULL) {
+		buffer->_elementDestructor(slot);
+	}
+	memcpy(slot, data, buffer->_elementSize);
+
+	return(GAPBUFFER_FUNC_SUCCESS);
+}
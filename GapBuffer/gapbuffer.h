@@ -0,0 +1,161 @@
+#ifndef _GAPBUFFER_H_
+#define _GAPBUFFER_H_
+
+/////////////////////////////////////////////////////////////////////////////////////////
+//  GapBuffer function return values
+/////////////////////////////////////////////////////////////////////////////////////////
+#define GAPBUFFER_EMPTY				 1	// No element on that side of the cursor
+#define GAPBUFFER_FUNC_SUCCESS		 0	// No error
+#define GAPBUFFER_ERR_NULL_ARG		-1	// Required pointer argument is NULL
+#define GAPBUFFER_ERR_INVALID_ARG	-2	// An invalid value has been passed to function
+#define GAPBUFFER_ERR_ALLOCATION	-3	// Gap buffer capacity resize has failed
+#define GAPBUFFER_ERR_OUT_OF_BOUNDS	-4	// Attempted to access an index out of bounds
+
+/////////////////////////////////////////////////////////////////////////////////////////
+//  Factor by which capacity grows when the gap is used up.
+/////////////////////////////////////////////////////////////////////////////////////////
+#define GAPBUFFER_CAPACITY_FACTOR	2
+
+/////////////////////////////////////////////////////////////////////////////////////////
+//  GapBuffer is the client-side data structure for a sequence edited at a moving
+//  cursor. Elements are stored in one allocation with an unused gap at the cursor:
+//  elements before the cursor sit at the start of the buffer, elements after it at the
+//  end. Inserting or removing at the cursor only resizes the gap, and moving the cursor
+//  moves just the elements between its old and new position across the gap. The
+//  members within GapBuffer will be managed with the GapBuffer_... functions and do not
+//  require client interaction.
+//  Member - _data:				 Pointer to the elements and the gap.
+//  Member - _capacity:			 Number of elements that fit in _data.
+//  Member - _elementSize:		 Size of each element.
+//  Member - _gapStart:			 Index of the first gap slot; also the cursor position.
+//  Member - _gapEnd:			 Index of the first slot after the gap.
+//  Member - _elementDestructor: Function pointer to client-side element destructor.
+/////////////////////////////////////////////////////////////////////////////////////////
+typedef struct _GapBuffer {
+	void* _data;
+	long _capacity;
+	int _elementSize;
+	long _gapStart;
+	long _gapEnd;
+	int (*_elementDestructor)(void*);
+} GapBuffer;
+
+/////////////////////////////////////////////////////////////////////////////////////////
+//  Initializes and allocates memory for gap buffer. The cursor starts at 0.
+//
+//  Arg - buffer:			 Pointer to the gap buffer which is being created.
+//  Arg - capacity:			 Desired initial capacity, in elements.
+//  Arg - elementSize:		 Size of each element.
+//  Arg - elementDestructor: Function pointer to client-side element destructor. It is
+//							 passed a pointer to the element within the buffer.
+//
+//  Returns: GAPBUFFER_... #defined above.
+/////////////////////////////////////////////////////////////////////////////////////////
+int GapBuffer_create(GapBuffer* buffer, long capacity, int elementSize, int (*elementDestructor)(void*));
+
+/////////////////////////////////////////////////////////////////////////////////////////
+//  Calls the destructor on every element and frees gap buffer memory.
+//
+//  Arg - buffer: Pointer to the gap buffer which is being destroyed.
+//
+//  Returns: GAPBUFFER_... #defined above.
+/////////////////////////////////////////////////////////////////////////////////////////
+int GapBuffer_destroy(GapBuffer* buffer);
+
+/////////////////////////////////////////////////////////////////////////////////////////
+//  Returns number of elements in gap buffer.
+//
+//  Arg - buffer: Pointer to the gap buffer.
+//
+//  Returns: Number of elements.
+/////////////////////////////////////////////////////////////////////////////////////////
+long GapBuffer_size(const GapBuffer* buffer);
+
+/////////////////////////////////////////////////////////////////////////////////////////
+//  Returns cursor position: the index the next inserted element will have.
+//
+//  Arg - buffer: Pointer to the gap buffer.
+//
+//  Returns: Cursor position, from 0 to GapBuffer_size.
+/////////////////////////////////////////////////////////////////////////////////////////
+long GapBuffer_cursor(const GapBuffer* buffer);
+
+/////////////////////////////////////////////////////////////////////////////////////////
+//  Moves cursor to position, moving the elements in between across the gap with one
+//  memmove.
+//
+//  Arg - buffer:	Pointer to the gap buffer.
+//  Arg - position:	New cursor position, from 0 to GapBuffer_size.
+//
+//  Returns: GAPBUFFER_... #defined above.
+/////////////////////////////////////////////////////////////////////////////////////////
+int GapBuffer_moveCursor(GapBuffer* buffer, long position);
+
+/////////////////////////////////////////////////////////////////////////////////////////
+//  Copies data into a new element at the cursor, and advances the cursor past it.
+//
+//  Arg - buffer: Pointer to the gap buffer.
+//  Arg - data:	  Pointer to the element to copy.
+//
+//  Returns: GAPBUFFER_... #defined above.
+//
+//  Note: The gap grows by GAPBUFFER_CAPACITY_FACTOR when it is used up.
+/////////////////////////////////////////////////////////////////////////////////////////
+int GapBuffer_insert(GapBuffer* buffer, const void* data);
+
+/////////////////////////////////////////////////////////////////////////////////////////
+//  Makes room for a new element at the cursor and advances the cursor past it, for the
+//  client to fill in place.
+//
+//  Arg - buffer: Pointer to the gap buffer.
+//
+//  Returns: Pointer to the new element, or NULL if the gap could not be grown.
+//
+//  Note: The contents of the new element are unspecified.
+/////////////////////////////////////////////////////////////////////////////////////////
+void* GapBuffer_emplace(GapBuffer* buffer);
+
+/////////////////////////////////////////////////////////////////////////////////////////
+//  Calls the destructor on the element after the cursor and removes it.
+//
+//  Arg - buffer: Pointer to the gap buffer.
+//
+//  Returns: GAPBUFFER_... #defined above. GAPBUFFER_EMPTY if the cursor is at the end.
+/////////////////////////////////////////////////////////////////////////////////////////
+int GapBuffer_remove(GapBuffer* buffer);
+
+/////////////////////////////////////////////////////////////////////////////////////////
+//  Calls the destructor on the element before the cursor and removes it, moving the
+//  cursor back by one.
+//
+//  Arg - buffer: Pointer to the gap buffer.
+//
+//  Returns: GAPBUFFER_... #defined above. GAPBUFFER_EMPTY if the cursor is at 0.
+/////////////////////////////////////////////////////////////////////////////////////////
+int GapBuffer_removeBefore(GapBuffer* buffer);
+
+/////////////////////////////////////////////////////////////////////////////////////////
+//  Returns pointer to element at index (after an in-bounds check), skipping the gap.
+//
+//  Arg - buffer: Pointer to the gap buffer.
+//  Arg - index:  Element to fetch.
+//
+//  Returns: Pointer to element, or NULL if index is out of bounds.
+//
+//  Note: The pointer is invalidated by any call which inserts, removes or moves the
+//		  cursor.
+/////////////////////////////////////////////////////////////////////////////////////////
+void* GapBuffer_get(const GapBuffer* buffer, long index);
+
+/////////////////////////////////////////////////////////////////////////////////////////
+//  Calls the destructor on the element at index and copies data over it.
+//
+//  Arg - buffer: Pointer to the gap buffer.
+//  Arg - data:	  Pointer to the element to copy.
+//  Arg - index:  Element to replace.
+//
+//  Returns: GAPBUFFER_... #defined above.
+/////////////////////////////////////////////////////////////////////////////////////////
+int GapBuffer_set(GapBuffer* buffer, const void* data, long index);
+
+#endif
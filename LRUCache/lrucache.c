@@ -0,0 +1,213 @@
+#include <stdlib.h>
+#include "lrucache.h"
+
+static void _unlinkRecency(LRUCache* cache, struct _LRUNode* node) {
+	if(node->prev != NULL) {
+		node->prev->next = node->next;
+	}
+	else {
+		cache->_firstNode = node->next;
+	}
+	if(node->next != NULL) {
+		node->next->prev = node->prev;
+	}
+	else {
+		cache->_lastNode = node->prev;
+	}
+}
+
+static void _pushFront(LRUCache* cache, struct _LRUNode* node) {
+	node->prev = NULL;
+	node->next = cache->_firstNode;
+	if(cache->_firstNode != NULL) {
+		cache->_firstNode->prev = node;
+	}
+	cache->_firstNode = node;
+	if(cache->_lastNode == NULL) {
+		cache->_lastNode = node;
+	}
+}
+
+static void _unlinkHash(LRUCache* cache, struct _LRUNode* node) {
+	struct _LRUNode** link = &cache->_buckets[node->hash & cache->_bucketMask];
+
+	while(*link != node) {
+		link = &(*link)->hashNext;
+	}
+	*link = node->hashNext;
+}
+
+static struct _LRUNode* _find(LRUCache* cache, void* probe) {
+	unsigned long hash = cache->_elementHash(probe);
+	struct _LRUNode* node = cache->_buckets[hash & cache->_bucketMask];
+
+	while(node != NULL) {
+		if(node->hash == hash && cache->_elementCompare(probe, node->data) == 0) {	// Zero means a match
+			return(node);
+		}
+		node = node->hashNext;
+	}
+	return(NULL);
+}
+
+//  Destroys the element in node and returns node to the free chain.
+static void _releaseNode(LRUCache* cache, struct _LRUNode* node) {
+	_unlinkRecency(cache, node);
+	_unlinkHash(cache, node);
+	if(cache->_elementDestructor != NULL) {
+		cache->_elementDestructor(node->data);
+	}
+	node->data = NULL;
+	node->next = cache->_freeNode;
+	cache->_freeNode = node;
+	cache->_size--;
+}
+
+int LRUCache_create(LRUCache* cache, long capacity, unsigned long (*elementHash)(void*), int (*elementCompare)(void*, void*), int (*elementDestructor)(void*)) {
+	if(cache == NULL || elementHash == NULL || elementCompare == NULL) {
+		return(LRUCACHE_ERR_NULL_ARG);
+	}
+	if(capacity < 1) {
+		return(LRUCACHE_ERR_INVALID_ARG);
+	}
+	unsigned long bucketCount = 1;
+
+	while(bucketCount < (unsigned long) capacity) {	// Load factor of at most one.
+		bucketCount <<= 1;
+	}
+	cache->_nodes = (struct _LRUNode*) malloc(capacity * sizeof(struct _LRUNode) );
+	cache->_buckets = (struct _LRUNode**) calloc(bucketCount, sizeof(struct _LRUNode*) );
+
+	if(cache->_nodes == NULL || cache->_buckets == NULL) {
+		free(cache->_nodes);
+		free(cache->_buckets);
+		return(LRUCACHE_ERR_ALLOCATION);
+	}
+	for(long i = 0; i < capacity; i++) {
+		cache->_nodes[i].next = (i + 1 < capacity) ? &cache->_nodes[i + 1] : NULL;
+		cache->_nodes[i].data = NULL;
+	}
+	cache->_firstNode = NULL;
+	cache->_lastNode = NULL;
+	cache->_freeNode = &cache->_nodes[0];
+	cache->_bucketMask = bucketCount - 1;
+	cache->_size = 0;
+	cache->_capacity = capacity;
+	cache->_elementHash = elementHash;
+	cache->_elementCompare = elementCompare;
+	cache->_elementDestructor = elementDestructor;
+
+	return(LRUCACHE_FUNC_SUCCESS);
+}
+
+int LRUCache_destroy(LRUCache* cache) {
+	if(cache == NULL) {
+		return(LRUCACHE_ERR_NULL_ARG);
+	}
+	if(cache->_elementDestructor != NULL) {
+		for(struct _LRUNode* node = cache->_firstNode; node != NULL; node = node->next) {
+			cache->_elementDestructor(node->data);
+		}
+	}
+	free(cache->_nodes);
+	free(cache->_buckets);
+	cache->_nodes = NULL;
+	cache->_buckets = NULL;
+	cache->_firstNode = NULL;
+	cache->_lastNode = NULL;
+	cache->_freeNode = NULL;
+	cache->_size = 0;
+
+	return(LRUCACHE_FUNC_SUCCESS);
+}
+
+long LRUCache_size(const LRUCache* cache) {
+	if(cache == NULL) {
+		return(LRUCACHE_ERR_NULL_ARG);
+	}
+	return(cache->_size);
+}
+
+int LRUCache_put(LRUCache* cache, void* data) {
+	if(cache == NULL || data == NULL) {
+		return(LRUCACHE_ERR_NULL_ARG);
+	}
+	struct _LRUNode* node = _find(cache, data);
+
+	if(node != NULL) {
+		if(cache->_elementDestructor != NULL && node->data != data) {
+			cache->_elementDestructor(node->data);
+		}
+		node->data = data;
+		_unlinkRecency(cache, node);
+		_pushFront(cache, node);
+		return(LRUCACHE_FUNC_SUCCESS);
+	}
+	if(cache->_freeNode == NULL) {
+		_releaseNode(cache, cache->_lastNode);	// Evict; the node goes straight back to us.
+	}
+	node = cache->_freeNode;
+	cache->_freeNode = node->next;
+
+	node->data = data;
+	node->hash = cache->_elementHash(data);
+	node->hashNext = cache->_buckets[node->hash & cache->_bucketMask];
+	cache->_buckets[node->hash & cache->_bucketMask] = node;
+	_pushFront(cache, node);
+	cache->_size++;
+
+	return(LRUCACHE_FUNC_SUCCESS);
+}
+
+void* LRUCache_get(LRUCache* cache, void* probe) {
+	if(cache == NULL || probe == NULL) {
+		return(NULL);
+	}
+	struct _LRUNode* node = _find(cache, probe);
+
+	if(node == NULL) {
+		return(NULL);
+	}
+	if(node != cache->_firstNode) {
+		_unlinkRecency(cache, node);
+		_pushFront(cache, node);
+	}
+	return(node->data);
+}
+
+void* LRUCache_peek(LRUCache* cache, void* probe) {
+	if(cache == NULL || probe == NULL) {
+		return(NULL);
+	}
+	struct _LRUNode* node = _find(cache, probe);
+
+	return(node != NULL ? node->data : NULL);
+}
+
+int LRUCache_touch(LRUCache* cache, void* probe) {
+	if(cache == NULL || probe == NULL) {
+		return(LRUCACHE_ERR_NULL_ARG);
+	}
+	return(LRUCache_get(cache, probe) != NULL ? LRUCACHE_FUNC_SUCCESS : LRUCACHE_ITEM_NOT_FOUND);
+}
+
+int LRUCache_remove(LRUCache* cache, void* probe) {
+	if(cache == NULL || probe == NULL) {
+		return(LRUCACHE_ERR_NULL_ARG);
+	}
+	struct _LRUNode* node = _find(cache, probe);
+
+	if(node == NULL) {
+		return(LRUCACHE_ITEM_NOT_FOUND);
+	}
+	_releaseNode(cache, node);
+
+	return(LRUCACHE_FUNC_SUCCESS);
+}
+
+void* LRUCache_last(LRUCache* cache) {
+	if(cache == NULL || cache->_lastNode == NULL) {
+		return(NULL);
+	}
+	return(cache->_lastNode->data);
+}
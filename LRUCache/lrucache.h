@@ -0,0 +1,142 @@
+#ifndef _LRUCACHE_H_
+#define _LRUCACHE_H_
+
+/////////////////////////////////////////////////////////////////////////////////////////
+//  LRUCache function return values
+/////////////////////////////////////////////////////////////////////////////////////////
+#define LRUCACHE_ITEM_NOT_FOUND		 2	// No cached element matches the probe
+#define LRUCACHE_EMPTY				 1	// Cache is empty
+#define LRUCACHE_FUNC_SUCCESS		 0	// No error
+#define LRUCACHE_ERR_NULL_ARG		-1	// Required pointer argument is NULL
+#define LRUCACHE_ERR_INVALID_ARG	-2	// An invalid value has been passed to function
+#define LRUCACHE_ERR_ALLOCATION		-3	// Node or bucket allocation has failed
+
+/////////////////////////////////////////////////////////////////////////////////////////
+//  _LRUNode is the internal atom of data used within the cache. Each node is linked
+//  both into the recency list (prev/next) and into a hash bucket chain (hashNext).
+//  Nodes are allocated once, as one pool, by LRUCache_create. These are managed within
+//  the LRUCache_... functions and do not require client interaction.
+/////////////////////////////////////////////////////////////////////////////////////////
+struct _LRUNode
+{
+	struct _LRUNode* next;
+	struct _LRUNode* prev;
+	struct _LRUNode* hashNext;
+	unsigned long hash;
+	void* data;
+};
+
+/////////////////////////////////////////////////////////////////////////////////////////
+//  LRUCache is the client-side data structure for a fixed capacity least recently used
+//  cache. Like LinkedList it stores client-allocated elements by pointer, and lookups
+//  take a probe element which is compared against cached elements. The members within
+//  LRUCache will be managed with the LRUCache_... functions and do not require client
+//  interaction.
+//  Member - _firstNode:		 Most recently used node.
+//  Member - _lastNode:			 Least recently used node, the next to be evicted.
+//  Member - _freeNode:			 Head of the chain (through next) of unused pool nodes.
+//  Member - _nodes:			 Node pool of _capacity nodes.
+//  Member - _buckets:			 Hash bucket chain heads.
+//  Member - _bucketMask:		 Number of buckets minus one (a power of two minus one).
+//  Member - _size:				 Number of cached elements.
+//  Member - _capacity:			 Maximum number of cached elements.
+//  Member - _elementHash:		 Client-side hash function.
+//  Member - _elementCompare:	 Client-side compare function, zero means a match.
+//  Member - _elementDestructor: Client-side element destructor, also called on eviction.
+/////////////////////////////////////////////////////////////////////////////////////////
+typedef struct _LRUCache
+{
+	struct _LRUNode* _firstNode;
+	struct _LRUNode* _lastNode;
+	struct _LRUNode* _freeNode;
+	struct _LRUNode* _nodes;
+	struct _LRUNode** _buckets;
+	unsigned long _bucketMask;
+	long _size;
+	long _capacity;
+	unsigned long (*_elementHash)(void*);
+	int (*_elementCompare)(void*, void*);
+	int (*_elementDestructor)(void*);
+}LRUCache;
+
+/////////////////////////////////////////////////////////////////////////////////////////
+//  Allocates the node pool and hash index for an empty cache. No further allocation
+//  happens until LRUCache_destroy.
+//  Arg - cache: The cache to create.
+//  Arg - capacity: Maximum number of cached elements.
+//  Arg - elementHash: Returns the hash of an element. Elements which compare equal
+//              must hash equal.
+//  Arg - elementCompare: Returns zero if two elements match, as for List_iteratorTo.
+//  Arg - elementDestructor: Called on elements which are evicted, replaced, removed
+//              or still cached at LRUCache_destroy. May be NULL.
+//  Returns: LRUCACHE_... #defined above.
+/////////////////////////////////////////////////////////////////////////////////////////
+int LRUCache_create(LRUCache* cache, long capacity, unsigned long (*elementHash)(void*), int (*elementCompare)(void*, void*), int (*elementDestructor)(void*));
+
+/////////////////////////////////////////////////////////////////////////////////////////
+//  Calls the destructor on every cached element and frees the node pool and index.
+//  Arg - cache: The cache to destroy.
+//  Returns: LRUCACHE_... #defined above.
+/////////////////////////////////////////////////////////////////////////////////////////
+int LRUCache_destroy(LRUCache* cache);
+
+/////////////////////////////////////////////////////////////////////////////////////////
+//  Returns number of cached elements.
+//  Arg - cache: The cache.
+//  Returns: Number of cached elements.
+/////////////////////////////////////////////////////////////////////////////////////////
+long LRUCache_size(const LRUCache* cache);
+
+/////////////////////////////////////////////////////////////////////////////////////////
+//  Caches data as the most recently used element in O(1).
+//  Arg - cache: The cache.
+//  Arg - data: Element to cache. It is the client responsibility to allocate and
+//              initialize data; the cache owns it from then on.
+//  Returns: LRUCACHE_... #defined above.
+//  Note: If an element matching data is already cached, it is destroyed and replaced
+//        by data. Otherwise, if the cache is full, the least recently used element is
+//        destroyed and its node reused.
+/////////////////////////////////////////////////////////////////////////////////////////
+int LRUCache_put(LRUCache* cache, void* data);
+
+/////////////////////////////////////////////////////////////////////////////////////////
+//  Looks up the element matching probe in O(1) and marks it most recently used.
+//  Arg - cache: The cache.
+//  Arg - probe: Element to match, e.g. a stack element with only the key filled in.
+//  Returns: Pointer to the cached element, or NULL if none matches.
+/////////////////////////////////////////////////////////////////////////////////////////
+void* LRUCache_get(LRUCache* cache, void* probe);
+
+/////////////////////////////////////////////////////////////////////////////////////////
+//  Looks up the element matching probe in O(1) without changing recency.
+//  Arg - cache: The cache.
+//  Arg - probe: Element to match.
+//  Returns: Pointer to the cached element, or NULL if none matches.
+/////////////////////////////////////////////////////////////////////////////////////////
+void* LRUCache_peek(LRUCache* cache, void* probe);
+
+/////////////////////////////////////////////////////////////////////////////////////////
+//  Marks the element matching probe most recently used in O(1).
+//  Arg - cache: The cache.
+//  Arg - probe: Element to match.
+//  Returns: LRUCACHE_... #defined above.
+/////////////////////////////////////////////////////////////////////////////////////////
+int LRUCache_touch(LRUCache* cache, void* probe);
+
+/////////////////////////////////////////////////////////////////////////////////////////
+//  Destroys and removes the element matching probe in O(1).
+//  Arg - cache: The cache.
+//  Arg - probe: Element to match.
+//  Returns: LRUCACHE_... #defined above.
+/////////////////////////////////////////////////////////////////////////////////////////
+int LRUCache_remove(LRUCache* cache, void* probe);
+
+/////////////////////////////////////////////////////////////////////////////////////////
+//  Returns the least recently used element, the one the next put into a full cache
+//  would evict.
+//  Arg - cache: The cache.
+//  Returns: Pointer to the least recently used element, or NULL if the cache is empty.
+/////////////////////////////////////////////////////////////////////////////////////////
+void* LRUCache_last(LRUCache* cache);
+
+#endif
@@ -1,6 +1,70 @@
+#include <errno.h>
+#include <limits.h>
 #include <stdlib.h>
+#include <string.h>
+#include <unistd.h>
 #include "list.h"
 
+struct _ListStreamHeader {
+	char magic[4];
+	int version;
+};
+
+struct _ListReadContext {
+	LinkedList* list;
+	void* (*elementDeserialize)(const void*, long);
+};
+
+static int _writeAll(int fd, const void* buffer, long size) {
+	long total = 0;
+
+	while(total < size) {
+		ssize_t written = write(fd, buffer + total, size - total);
+
+		if(written < 0) {
+			if(errno == EINTR) {
+				continue;
+			}
+			return(LIST_ERR_IO);
+		}
+		total += written;
+	}
+	return(LIST_FUNC_SUCCESS);
+}
+
+//  Compacts buffer and reads until at least minimum bytes are buffered or end of file.
+static int _fillBuffer(int fd, void* buffer, long capacity, long* start, long* end, long minimum) {
+	memmove(buffer, buffer + *start, *end - *start);
+	*end -= *start;
+	*start = 0;
+
+	while(*end < minimum) {
+		ssize_t bytesRead = read(fd, buffer + *end, capacity - *end);
+
+		if(bytesRead < 0) {
+			if(errno == EINTR) {
+				continue;
+			}
+			return(LIST_ERR_IO);
+		}
+		if(bytesRead == 0) {
+			return(LIST_ERR_IO);	// Stream is truncated.
+		}
+		*end += bytesRead;
+	}
+	return(LIST_FUNC_SUCCESS);
+}
+
+static int _appendDeserialized(const void* buffer, long size, void* context) {
+	struct _ListReadContext* readContext = (struct _ListReadContext*) context;
+	void* data = readContext->elementDeserialize(buffer, size);
+
+	if(data == NULL) {
+		return(LIST_ERR_ALLOCATION);
+	}
+	return(List_append(readContext->list, data) );
+}
+
 int List_create(LinkedList* list, int (*elementDestructor)(void*)) {
 	if(list == NULL) {
 		return(LIST_ERR_NULL_ARG);
@@ -9,6 +73,7 @@ int List_create(LinkedList* list, int (*elementDestructor)(void*)) {
 	list->_lastNode  = NULL;
 	list->_curNode   = NULL;
 	list->_elementDestructor = elementDestructor;
+	ATL_STAT_INIT(list);
 
 	return(LIST_FUNC_SUCCESS);
 }
@@ -27,6 +92,7 @@ int List_append(LinkedList* list, void* data) {
 		return(LIST_ERR_NULL_ARG);
 	}
 	list->_lastNode = _insertNode(list->_lastNode, NULL, data);
+	ATL_STAT_ADD(list, nodeAllocs, 1);
 	//  If list was empty we need to initialize all member variables.
 	if(list->_firstNode == NULL) {
 		list->_firstNode = list->_curNode = list->_lastNode;
@@ -49,8 +115,12 @@ int List_behead(LinkedList* list) {
 	if(list->_lastNode == list->_firstNode) {
 		list->_lastNode = newFirstNode; // Will be null if firstNode was the last node.
 	}
-	list->_elementDestructor(list->_firstNode->data);
+	if(list->_elementDestructor != NULL) {
+		list->_elementDestructor(list->_firstNode->data);
+		ATL_STAT_ADD(list, destructorCalls, 1);
+	}
 	_removeNode(list->_firstNode);
+	ATL_STAT_ADD(list, nodeFrees, 1);
 	list->_firstNode = newFirstNode; 	// You guessed it; will be null if firstNode was last node.
 
 	return(LIST_FUNC_SUCCESS);
@@ -61,6 +131,7 @@ int List_prepend(LinkedList* list, void* data) {
 		return(LIST_ERR_NULL_ARG);
 	}
 	list->_firstNode = _insertNode(NULL, list->_firstNode, data);
+	ATL_STAT_ADD(list, nodeAllocs, 1);
 	//  If list was empty we need to initialize all member variables.
 	if(list->_lastNode == NULL) {
 		 list->_lastNode = list->_curNode = list->_firstNode;
@@ -83,8 +154,12 @@ int List_chop(LinkedList* list) {
 	if(list->_firstNode == list->_lastNode) {
 		list->_firstNode = newLastNode; // Will be null if firstNode was the last node.
 	}
-	list->_elementDestructor(list->_lastNode->data);
+	if(list->_elementDestructor != NULL) {
+		list->_elementDestructor(list->_lastNode->data);
+		ATL_STAT_ADD(list, destructorCalls, 1);
+	}
 	_removeNode(list->_lastNode);
+	ATL_STAT_ADD(list, nodeFrees, 1);
 	list->_lastNode = newLastNode;		// You guessed it; will be null if firstNode was last node.
 
 	return(LIST_FUNC_SUCCESS);
@@ -122,7 +197,7 @@ int List_remove(LinkedList* list, void* data, int (*elementCompare)(void*, void*
 	return(returnVal);
 }
 
-int List_replace(LinkedList* list, void* data) {
+int List_replace(LinkedList* list, void* replaceItem, void* data) {
 	return(LIST_FUNC_SUCCESS);
 }
 
@@ -172,7 +247,9 @@ int List_iteratorTo(LinkedList* list, void* data, int (*elementCompare)(void*, v
 	if(list ==  NULL || data == NULL) {
 		return(LIST_ERR_NULL_ARG);
 	}
+	ATL_STAT_ADD(list, searches, 1);
 	while(list->_curNode != NULL) {
+		ATL_STAT_ADD(list, nodesVisited, 1);
 		if(elementCompare != NULL) {
 			if(elementCompare(data, list->_curNode->data) == 0) { // Zero means a match
 				return(LIST_FUNC_SUCCESS);
@@ -196,6 +273,7 @@ int List_iteratorInsert(LinkedList* list, void* data) {
 		return(List_prepend(list, data));
 	}
 	_insertNode(list->_curNode->prev, list->_curNode, data);
+	ATL_STAT_ADD(list, nodeAllocs, 1);
 	return(LIST_FUNC_SUCCESS);
 }
 
@@ -217,8 +295,12 @@ int List_iteratorRemove(LinkedList* list) {
 		if(newCurNode == NULL) {
 			newCurNode = list->_curNode->prev;
 		}
-		list->_elementDestructor(list->_curNode->data);
+		if(list->_elementDestructor != NULL) {
+			list->_elementDestructor(list->_curNode->data);
+			ATL_STAT_ADD(list, destructorCalls, 1);
+		}
 		_removeNode(list->_curNode);
+		ATL_STAT_ADD(list, nodeFrees, 1);
 		list->_curNode = newCurNode;
 	}
 	return(LIST_FUNC_SUCCESS);
@@ -249,6 +331,384 @@ void* List_last(LinkedList* list) {
 	return(list->_lastNode->data);
 }
 
+int List_write(LinkedList* list, int fd, long (*elementSerialize)(const void*, void*, long)) {
+	if(list == NULL || elementSerialize == NULL) {
+		return(LIST_ERR_NULL_ARG);
+	}
+	struct _ListStreamHeader header;
+	struct _ListNode* node = list->_firstNode;
+	long capacity = LIST_IO_CHUNK_SIZE;
+	long used = sizeof(header);
+	long endMarker = -1;
+	int returnVal = LIST_FUNC_SUCCESS;
+	void* buffer = malloc(capacity);
+
+	if(buffer == NULL) {
+		return(LIST_ERR_ALLOCATION);
+	}
+	memset(&header, '\0', sizeof(header) );
+	memcpy(header.magic, LIST_STREAM_MAGIC, sizeof(header.magic) );
+	header.version = LIST_STREAM_VERSION;
+	memcpy(buffer, &header, sizeof(header) );
+
+	while(node != NULL && returnVal == LIST_FUNC_SUCCESS) {
+		if(capacity - used < (long) sizeof(long) ) {
+			//  No room left for the length word; flush first. capacity never drops below
+			//  a chunk, so the empty buffer always has room.
+			returnVal = _writeAll(fd, buffer, used);
+			used = 0;
+			if(returnVal != LIST_FUNC_SUCCESS) {
+				break;
+			}
+		}
+		long length = elementSerialize(node->data, buffer + used + sizeof(long), capacity - used - (long) sizeof(long) );
+
+		if(length < 0 || length > LONG_MAX - (long) sizeof(long) ) {
+			returnVal = LIST_ERR_INVALID_ARG;
+			break;
+		}
+		if(length > capacity - used - (long) sizeof(long) ) {
+			// Element did not fit; flush the buffer, growing it if the element alone is
+			// bigger than a chunk, then serialize the element again.
+			returnVal = _writeAll(fd, buffer, used);
+			used = 0;
+			if(returnVal != LIST_FUNC_SUCCESS) {
+				break;
+			}
+			if(length > capacity - (long) sizeof(long) ) {
+				void* newBuffer = realloc(buffer, sizeof(long) + length);
+
+				if(newBuffer == NULL) {
+					returnVal = LIST_ERR_ALLOCATION;
+					break;
+				}
+				buffer = newBuffer;
+				capacity = sizeof(long) + length;
+			}
+			length = elementSerialize(node->data, buffer + sizeof(long), capacity - sizeof(long) );
+			if(length < 0 || length > capacity - (long) sizeof(long) ) {
+				returnVal = LIST_ERR_INVALID_ARG;
+				break;
+			}
+		}
+		memcpy(buffer + used, &length, sizeof(long) );
+		used += sizeof(long) + length;
+		node = node->next;
+	}
+	if(returnVal == LIST_FUNC_SUCCESS) {
+		if(used + (long) sizeof(long) > capacity) {
+			returnVal = _writeAll(fd, buffer, used);
+			used = 0;
+		}
+		memcpy(buffer + used, &endMarker, sizeof(long) );
+		used += sizeof(long);
+		if(returnVal == LIST_FUNC_SUCCESS) {
+			returnVal = _writeAll(fd, buffer, used);
+		}
+	}
+	free(buffer);
+
+	return(returnVal);
+}
+
+int List_read(LinkedList* list, int fd, void* (*elementDeserialize)(const void*, long), int (*elementDestructor)(void*)) {
+	if(list == NULL || elementDeserialize == NULL) {
+		return(LIST_ERR_NULL_ARG);
+	}
+	struct _ListReadContext context;
+
+	List_create(list, elementDestructor);
+	context.list = list;
+	context.elementDeserialize = elementDeserialize;
+
+	int returnVal = List_readStream(fd, _appendDeserialized, &context);
+
+	if(returnVal != LIST_FUNC_SUCCESS) {
+		List_destroy(list);
+	}
+	return(returnVal);
+}
+
+int List_readStream(int fd, int (*elementCallback)(const void*, long, void*), void* context) {
+	if(elementCallback == NULL) {
+		return(LIST_ERR_NULL_ARG);
+	}
+	struct _ListStreamHeader header;
+	long capacity = LIST_IO_CHUNK_SIZE;
+	long start = 0;
+	long end = 0;
+	long length;
+	void* buffer = malloc(capacity);
+
+	if(buffer == NULL) {
+		return(LIST_ERR_ALLOCATION);
+	}
+	int returnVal = _fillBuffer(fd, buffer, capacity, &start, &end, sizeof(header) );
+
+	if(returnVal == LIST_FUNC_SUCCESS) {
+		memcpy(&header, buffer, sizeof(header) );
+		start += sizeof(header);
+		if(memcmp(header.magic, LIST_STREAM_MAGIC, sizeof(header.magic) ) != 0 || header.version != LIST_STREAM_VERSION) {
+			returnVal = LIST_ERR_INVALID_ARG;
+		}
+	}
+	while(returnVal == LIST_FUNC_SUCCESS) {
+		if(end - start < (long) sizeof(long) ) {
+			returnVal = _fillBuffer(fd, buffer, capacity, &start, &end, sizeof(long) );
+			if(returnVal != LIST_FUNC_SUCCESS) {
+				break;
+			}
+		}
+		memcpy(&length, buffer + start, sizeof(long) );
+		if(length == -1) {
+			//  End of list. Give back what was read ahead past the frame, if fd can seek.
+			long unread = end - start - (long) sizeof(long);
+
+			if(unread > 0) {
+				lseek(fd, -unread, SEEK_CUR);
+			}
+			break;
+		}
+		//  Checked before any arithmetic on length, which a corrupt stream controls.
+		if(length < 0 || length > LONG_MAX - (long) sizeof(long) ) {
+			returnVal = LIST_ERR_INVALID_ARG;
+			break;
+		}
+		if(end - start < (long) sizeof(long) + length) {
+			if( (long) sizeof(long) + length > capacity) {
+				void* newBuffer;
+
+				memmove(buffer, buffer + start, end - start);
+				end -= start;
+				start = 0;
+				newBuffer = realloc(buffer, sizeof(long) + length);
+				if(newBuffer == NULL) {
+					returnVal = LIST_ERR_ALLOCATION;
+					break;
+				}
+				buffer = newBuffer;
+				capacity = sizeof(long) + length;
+			}
+			returnVal = _fillBuffer(fd, buffer, capacity, &start, &end, sizeof(long) + length);
+			if(returnVal != LIST_FUNC_SUCCESS) {
+				break;
+			}
+		}
+		returnVal = elementCallback(buffer + start + sizeof(long), length, context);
+		start += sizeof(long) + length;
+	}
+	free(buffer);
+
+	return(returnVal);
+}
+
+int List_stats(const LinkedList* list, AtlStats* stats) {
+	if(list == NULL || stats == NULL) {
+		return(ATLSTATS_ERR_NULL_ARG);
+	}
+#ifdef ATL_STATS
+	memcpy(stats, &list->_stats, sizeof(AtlStats) );
+
+	return(ATLSTATS_FUNC_SUCCESS);
+#else
+	memset(stats, '\0', sizeof(AtlStats) );
+
+	return(ATLSTATS_DISABLED);
+#endif
+}
+
+//  Advances the run-ahead node of a traversal by one, prefetching the node it lands on
+//  and the element of the node it leaves.
+static struct _ListNode* _prefetchAhead(struct _ListNode* ahead, int prefetchData) {
+	if(ahead == NULL) {
+		return(NULL);
+	}
+	if(prefetchData) {
+		__builtin_prefetch(ahead->data);
+	}
+	ahead = ahead->next;
+	if(ahead != NULL) {
+		__builtin_prefetch(ahead);
+	}
+	return(ahead);
+}
+
+static struct _ListNode* _startAhead(struct _ListNode* node, int prefetchData) {
+	for(int i = 0; i < LIST_PREFETCH_DISTANCE && node != NULL; i++) {
+		node = _prefetchAhead(node, prefetchData);
+	}
+	return(node);
+}
+
+int List_toVector(LinkedList* list, Vector* vector, long elementSize) {
+	if(list == NULL || vector == NULL) {
+		return(LIST_ERR_NULL_ARG);
+	}
+	if(elementSize < 0 || elementSize > INT_MAX) {
+		return(LIST_ERR_INVALID_ARG);
+	}
+	int gatherPointers = (elementSize == 0);
+
+	if(Vector_create(vector, 16, gatherPointers ? (long) sizeof(void*) : elementSize, NULL) != VECTOR_FUNC_SUCCESS ||
+	   Vector_array(vector) == NULL) {
+		return(LIST_ERR_ALLOCATION);
+	}
+	struct _ListNode* ahead = _startAhead(list->_firstNode, !gatherPointers);
+
+	for(struct _ListNode* node = list->_firstNode; node != NULL; node = node->next) {
+		void* slot = Vector_emplaceBack(vector);
+
+		if(slot == NULL) {
+			Vector_destroy(vector);
+			return(LIST_ERR_ALLOCATION);
+		}
+		ahead = _prefetchAhead(ahead, !gatherPointers);
+		if(gatherPointers) {
+			*(void**) slot = node->data;
+		}
+		else {
+			memcpy(slot, node->data, elementSize);
+		}
+		ATL_STAT_ADD(list, nodesVisited, 1);
+	}
+	return(LIST_FUNC_SUCCESS);
+}
+
+//  Links the count nodes which follow block, in order, as the only nodes of list.
+static void _linkBlock(LinkedList* list, struct _ListBlock* block, long count) {
+	struct _ListNode* nodes = (struct _ListNode*) (block + 1);
+
+	block->nodeCount = count;
+	for(long i = 0; i < count; i++) {
+		nodes[i].prev = (i > 0) ? &nodes[i - 1] : NULL;
+		nodes[i].next = (i + 1 < count) ? &nodes[i + 1] : NULL;
+		nodes[i].block = block;
+	}
+	list->_firstNode = &nodes[0];
+	list->_lastNode = &nodes[count - 1];
+	ATL_STAT_ADD(list, nodeAllocs, count);
+}
+
+int List_fromVector(LinkedList* list, const Vector* vector, int copyElements, int (*elementDestructor)(void*)) {
+	if(list == NULL || vector == NULL) {
+		return(LIST_ERR_NULL_ARG);
+	}
+	long count = Vector_size(vector);
+	long elementSize = vector->_elementSize;
+
+	if(!copyElements && elementSize != sizeof(void*) ) {
+		return(LIST_ERR_INVALID_ARG);
+	}
+	List_create(list, elementDestructor);
+	if(count == 0) {
+		return(LIST_FUNC_SUCCESS);
+	}
+	//  Block header, then the nodes, then (if copying) the elements.
+	struct _ListBlock* block = (struct _ListBlock*) malloc(sizeof(struct _ListBlock) +
+	                           count * sizeof(struct _ListNode) + (copyElements ? count * elementSize : 0) );
+
+	if(block == NULL) {
+		return(LIST_ERR_ALLOCATION);
+	}
+	struct _ListNode* nodes = (struct _ListNode*) (block + 1);
+	void* elements = (void*) (nodes + count);
+	const void* source = Vector_array(vector);
+
+	if(copyElements) {
+		memcpy(elements, source, count * elementSize);
+	}
+	for(long i = 0; i < count; i++) {
+		nodes[i].data = copyElements ? elements + (i * elementSize) : ( (void* const*) source)[i];
+	}
+	_linkBlock(list, block, count);
+	list->_curNode = list->_firstNode;
+
+	return(LIST_FUNC_SUCCESS);
+}
+
+int List_forEach(LinkedList* list, int (*callback)(void*, void*), void* context) {
+	if(list == NULL || callback == NULL) {
+		return(LIST_ERR_NULL_ARG);
+	}
+	struct _ListNode* ahead = _startAhead(list->_firstNode, 1);
+
+	for(struct _ListNode* node = list->_firstNode; node != NULL; node = node->next) {
+		ahead = _prefetchAhead(ahead, 1);
+		ATL_STAT_ADD(list, nodesVisited, 1);
+
+		int returnVal = callback(node->data, context);
+
+		if(returnVal != LIST_FUNC_SUCCESS) {
+			return(returnVal);
+		}
+	}
+	return(LIST_FUNC_SUCCESS);
+}
+
+int List_move(LinkedList* to, LinkedList* from) {
+	if(to == NULL || from == NULL) {
+		return(LIST_ERR_NULL_ARG);
+	}
+	*to = *from;
+
+	return(List_create(from, from->_elementDestructor) );
+}
+
+int List_swap(LinkedList* a, LinkedList* b) {
+	if(a == NULL || b == NULL) {
+		return(LIST_ERR_NULL_ARG);
+	}
+	LinkedList temp = *a;
+
+	*a = *b;
+	*b = temp;
+
+	return(LIST_FUNC_SUCCESS);
+}
+
+int List_clone(LinkedList* clone, LinkedList* list, void* (*elementCopy)(const void*)) {
+	if(clone == NULL || list == NULL) {
+		return(LIST_ERR_NULL_ARG);
+	}
+	long count = 0;
+
+	for(struct _ListNode* node = list->_firstNode; node != NULL; node = node->next) {
+		count++;
+	}
+	List_create(clone, (elementCopy != NULL) ? list->_elementDestructor : NULL);
+	if(count == 0) {
+		return(LIST_FUNC_SUCCESS);
+	}
+	struct _ListBlock* block = (struct _ListBlock*) malloc(sizeof(struct _ListBlock) + count * sizeof(struct _ListNode) );
+
+	if(block == NULL) {
+		return(LIST_ERR_ALLOCATION);
+	}
+	struct _ListNode* nodes = (struct _ListNode*) (block + 1);
+	struct _ListNode* ahead = _startAhead(list->_firstNode, elementCopy != NULL);
+	long i = 0;
+
+	for(struct _ListNode* node = list->_firstNode; node != NULL; node = node->next, i++) {
+		ahead = _prefetchAhead(ahead, elementCopy != NULL);
+		nodes[i].data = (elementCopy != NULL) ? elementCopy(node->data) : node->data;
+		if(nodes[i].data == NULL) {
+			while(--i >= 0) {
+				if(clone->_elementDestructor != NULL) {
+					clone->_elementDestructor(nodes[i].data);
+				}
+			}
+			free(block);
+			return(LIST_ERR_ALLOCATION);
+		}
+		if(node == list->_curNode) {
+			clone->_curNode = &nodes[i];
+		}
+	}
+	_linkBlock(clone, block, count);
+
+	return(LIST_FUNC_SUCCESS);
+}
+
 int _removeNode(struct _ListNode* node) {
 	if(node->next != NULL) {
 		node->next->prev = node->prev;
@@ -256,7 +716,12 @@ int _removeNode(struct _ListNode* node) {
 	if(node->prev != NULL) {
 		node->prev->next = node->next;
 	}
-	free(node);
+	if(node->block == NULL) {
+		free(node);
+	}
+	else if(--node->block->nodeCount == 0) {
+		free(node->block);
+	}
 
 	return(0);
 }
@@ -273,6 +738,7 @@ void* _insertNode(struct _ListNode* prevNode, struct _ListNode* nextNode, void*
 	newNode->next = nextNode;
 	newNode->prev = prevNode;
 	newNode->data = data;
+	newNode->block = NULL;
 
 	return(newNode);
 }
@@ -1,6 +1,9 @@
 #ifndef _LIST_H_
 #define _LIST_H_
 
+#include "../Stats/atlstats.h"
+#include "../Vector/vector.h"
+
 /////////////////////////////////////////////////////////////////////////////////////////
 //  Vector function return values
 /////////////////////////////////////////////////////////////////////////////////////////
@@ -10,6 +13,33 @@
 #define LIST_ERR_NULL_ARG	 	-1	// Required pointer argument is NULL
 #define LIST_ERR_INVALID_ARG 	-2	// An invalid value has been passed to function
 #define LIST_ERR_ALLOCATION	 	-3	// List capacity resize has failed
+#define LIST_ERR_IO			 	-4	// A read or write on a file descriptor has failed
+
+/////////////////////////////////////////////////////////////////////////////////////////
+//  List stream format, as written by List_write. A frame header of
+//		char[4] magic ("ATSL"), int version
+//  is followed by one record per element, each a long byte length followed by that
+//  many bytes of serialized element, and terminated by a record length of -1.
+//  LIST_IO_CHUNK_SIZE is the size of the buffer used to batch reads and writes.
+/////////////////////////////////////////////////////////////////////////////////////////
+#define LIST_STREAM_MAGIC		"ATSL"
+#define LIST_STREAM_VERSION		1
+#define LIST_IO_CHUNK_SIZE		(1 << 20)
+
+/////////////////////////////////////////////////////////////////////////////////////////
+//  Number of nodes List_toVector and List_forEach prefetch ahead of the node being
+//  visited.
+/////////////////////////////////////////////////////////////////////////////////////////
+#define LIST_PREFETCH_DISTANCE	4
+
+/////////////////////////////////////////////////////////////////////////////////////////
+//  _ListBlock heads a single allocation holding several nodes (and, optionally, their
+//  elements), as made by List_fromVector. It is freed once its last node is removed.
+/////////////////////////////////////////////////////////////////////////////////////////
+struct _ListBlock
+{
+	long nodeCount;
+};
 
 /////////////////////////////////////////////////////////////////////////////////////////
 //  _ListNode is the internal atom of data used within the linked
@@ -24,6 +54,7 @@ struct _ListNode
 	void* data;
 	int (*elementDestructor)(void*);
 	int test;
+	struct _ListBlock* block;	// NULL if the node was allocated on its own.
 };
 
 /////////////////////////////////////////////////////////////////////////////////////////
@@ -34,6 +65,8 @@ struct _ListNode
 //  Member - _lastNode:  Will always point to tail node.
 //  Member - _curNode:   Internal iterator node. Its state will vary
 //                       depending on various List_... function calls.
+//  Member - _stats:     Instrumentation counters, only present when built
+//                       with ATL_STATS.
 /////////////////////////////////////////////////////////////////////////////////////////
 typedef struct _LinkedList
 {
@@ -41,6 +74,9 @@ typedef struct _LinkedList
 	struct _ListNode* _lastNode;
 	struct _ListNode* _curNode;
 	int (*_elementDestructor)(void*);
+#ifdef ATL_STATS
+	AtlStats _stats;
+#endif
 }LinkedList;
 
 /////////////////////////////////////////////////////////////////////////////////////////
@@ -160,6 +196,131 @@ void* List_first(LinkedList* list);
 /////////////////////////////////////////////////////////////////////////////////////////
 void* List_last(LinkedList* list);
 
+/////////////////////////////////////////////////////////////////////////////////////////
+//  Serializes list to a file descriptor. Elements are serialized into a buffer of
+//  LIST_IO_CHUNK_SIZE bytes which is written out whenever it fills.
+//  Arg - list: The list to write.
+//  Arg - fd: Open file descriptor to write to (file, pipe or socket).
+//  Arg - elementSerialize: Called with an element, a buffer and the buffer size. It
+//              must return the number of bytes the serialized element needs, and
+//              only write the element if that fits in the buffer (as snprintf
+//              does). A negative return value aborts the write.
+//  Returns: LIST_... #defined above.
+//  Note: The iterator node is not affected.
+/////////////////////////////////////////////////////////////////////////////////////////
+int List_write(LinkedList* list, int fd, long (*elementSerialize)(const void*, void*, long));
+
+/////////////////////////////////////////////////////////////////////////////////////////
+//  Initializes list from a stream written by List_write.
+//  Arg - list: The list to create.
+//  Arg - fd: Open file descriptor to read from.
+//  Arg - elementDeserialize: Called with each serialized element and its size, it
+//              must return a newly allocated element to append, or NULL on error.
+//  Arg - elementDestructor: Function pointer to client-side element destructor.
+//  Returns: LIST_... #defined above.
+//  Note: On error every element read so far is destroyed and the list is left empty.
+/////////////////////////////////////////////////////////////////////////////////////////
+int List_read(LinkedList* list, int fd, void* (*elementDeserialize)(const void*, long), int (*elementDestructor)(void*));
+
+/////////////////////////////////////////////////////////////////////////////////////////
+//  Reads a stream written by List_write incrementally, passing each serialized
+//  element to a callback instead of building a list. Only one chunk of
+//  LIST_IO_CHUNK_SIZE bytes (or one element, if larger) is resident at a time.
+//  Arg - fd: Open file descriptor to read from.
+//  Arg - elementCallback: Called with each serialized element, its size and context.
+//              A non-zero return value stops the read.
+//  Arg - context: Client pointer passed through to elementCallback.
+//  Returns: LIST_... #defined above, or the non-zero value returned by
+//           elementCallback if it stopped the read. LIST_ERR_INVALID_ARG if the stream
+//           is corrupt, LIST_ERR_IO if it is truncated.
+//  Note: Reads run ahead by up to a chunk. On a seekable fd the bytes read past the end
+//        of the list are given back, so further data can follow it; pipes and sockets
+//        should carry one list per fd.
+/////////////////////////////////////////////////////////////////////////////////////////
+int List_readStream(int fd, int (*elementCallback)(const void*, long, void*), void* context);
+
+/////////////////////////////////////////////////////////////////////////////////////////
+//  Copies the instrumentation counters of a list.
+//  Arg - list: The list.
+//  Arg - stats: Receives the counters.
+//  Returns: ATLSTATS_... #defined in atlstats.h. ATLSTATS_DISABLED (with all
+//           counters zeroed) if the library was built without ATL_STATS.
+/////////////////////////////////////////////////////////////////////////////////////////
+int List_stats(const LinkedList* list, AtlStats* stats);
+
+/////////////////////////////////////////////////////////////////////////////////////////
+//  Gathers the elements of list, in order, into a new contiguous vector in one pass,
+//  prefetching LIST_PREFETCH_DISTANCE nodes ahead.
+//  Arg - list: The list to gather. It is not modified.
+//  Arg - vector: The vector to create.
+//  Arg - elementSize: Size of the element each node points to, whose bytes are copied
+//              into vector; or 0 to gather the element pointers themselves (vector
+//              element size sizeof(void*) ).
+//  Returns: LIST_... #defined above.
+//  Note: vector is created without an element destructor; the list keeps ownership of
+//        its elements, so gathered pointers are valid only while the list holds them.
+/////////////////////////////////////////////////////////////////////////////////////////
+int List_toVector(LinkedList* list, Vector* vector, long elementSize);
+
+/////////////////////////////////////////////////////////////////////////////////////////
+//  Initializes list with one node per vector element, in order, using a single
+//  allocation for every node.
+//  Arg - list: The list to create.
+//  Arg - vector: The vector to read. It is not modified.
+//  Arg - copyElements: If 0, vector holds element pointers (element size sizeof(void*) )
+//              and the list takes ownership of what they point to. Otherwise each
+//              element is copied into the same allocation as the nodes.
+//  Arg - elementDestructor: Function pointer to client-side element destructor.
+//  Returns: LIST_... #defined above.
+//  Note: With copyElements the list does not own separately allocated elements, so
+//        elementDestructor must only release what an element refers to and must not
+//        free the element itself. The allocation is returned once every node made
+//        here has been removed.
+/////////////////////////////////////////////////////////////////////////////////////////
+int List_fromVector(LinkedList* list, const Vector* vector, int copyElements, int (*elementDestructor)(void*));
+
+/////////////////////////////////////////////////////////////////////////////////////////
+//  Calls callback on each element from first to last, prefetching
+//  LIST_PREFETCH_DISTANCE nodes (and their elements) ahead.
+//  Arg - list: The list.
+//  Arg - callback: Called with each element and context. A non-zero return value
+//              stops the traversal.
+//  Arg - context: Client pointer passed through to callback.
+//  Returns: LIST_... #defined above, or the non-zero value returned by callback if it
+//           stopped the traversal.
+//  Note: The iterator node is not affected. callback must not add or remove nodes.
+/////////////////////////////////////////////////////////////////////////////////////////
+int List_forEach(LinkedList* list, int (*callback)(void*, void*), void* context);
+
+/////////////////////////////////////////////////////////////////////////////////////////
+//  Transfers the node chain, iterator node and destructor of from to to in O(1).
+//  Arg - to: The list to initialize. It must not hold a live list.
+//  Arg - from: The list to move from. It is left empty, keeping its destructor.
+//  Returns: LIST_... #defined above.
+/////////////////////////////////////////////////////////////////////////////////////////
+int List_move(LinkedList* to, LinkedList* from);
+
+/////////////////////////////////////////////////////////////////////////////////////////
+//  Exchanges the contents of two lists in O(1).
+//  Arg - a: The first list.
+//  Arg - b: The second list.
+//  Returns: LIST_... #defined above.
+/////////////////////////////////////////////////////////////////////////////////////////
+int List_swap(LinkedList* a, LinkedList* b);
+
+/////////////////////////////////////////////////////////////////////////////////////////
+//  Initializes clone with the elements of list, in order, using a single allocation for
+//  every node. The iterator node of clone corresponds to that of list.
+//  Arg - clone: The list to create.
+//  Arg - list: The list to copy. It is not modified.
+//  Arg - elementCopy: Client-side function returning a new copy of its element, or NULL
+//              on failure; clone then owns the copies and has the destructor of list.
+//              If elementCopy is NULL, clone shares the elements of list and has no
+//              destructor, so it must not outlive them.
+//  Returns: LIST_... #defined above. On failure the copies made so far are destroyed.
+/////////////////////////////////////////////////////////////////////////////////////////
+int List_clone(LinkedList* clone, LinkedList* list, void* (*elementCopy)(const void*));
+
 /////////////////////////////////////////////////////////////////////////////////////////
 /////////////////////////////////////////////////////////////////////////////////////////
 void* _insertNode(struct _ListNode* prevNode, struct _ListNode* nextNode, void* data);
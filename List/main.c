@@ -1,5 +1,8 @@
+#include <limits.h>
 #include <stdlib.h>
 #include <stdio.h>
+#include <string.h>
+#include <unistd.h>
 
 #include "list.h"
 
@@ -79,6 +82,67 @@ int listEmployees() {
 	return(0);
 }
 
+long employeeSerialize(const void* employee, void* buffer, long size) {
+	if(size >= (long) sizeof(Employee) ) {
+		memcpy(buffer, employee, sizeof(Employee) );
+	}
+	return(sizeof(Employee) );
+}
+
+void* employeeDeserialize(const void* buffer, long size) {
+	Employee* newEmployee;
+
+	if(size != sizeof(Employee) || (newEmployee = (Employee*) malloc(sizeof(Employee) ) ) == NULL) {
+		return(NULL);
+	}
+	memcpy(newEmployee, buffer, sizeof(Employee) );
+	newEmployee->data = NULL;
+
+	return(newEmployee);
+}
+
+//  Writes the list to a temporary file and reads it back whole, truncated and corrupt.
+int streamCheck() {
+	LinkedList readList;
+	FILE* file = tmpfile();
+	int fd;
+	char header[8];
+	long corruptLength = LONG_MAX - 3;
+	long written;
+	int returnVal;
+
+	if(file == NULL) {
+		return(1);
+	}
+	fd = fileno(file);
+	List_write(&employeeList, fd, employeeSerialize);
+	written = lseek(fd, 0, SEEK_END);
+
+	lseek(fd, 0, SEEK_SET);
+	returnVal = List_read(&readList, fd, employeeDeserialize, employeeDestructor);
+	printf("Round trip:  %d\n", returnVal);
+	List_destroy(&readList);
+
+	//  Cut off the end marker and the last byte before it.
+	ftruncate(fd, written - sizeof(long) - 1);
+	lseek(fd, 0, SEEK_SET);
+	printf("Truncated stream:  %d (expected %d)\n", List_read(&readList, fd, employeeDeserialize, employeeDestructor), LIST_ERR_IO);
+
+	//  A valid header followed by a record length which would overflow.
+	lseek(fd, 0, SEEK_SET);
+	read(fd, header, sizeof(header) );
+	ftruncate(fd, 0);
+	lseek(fd, 0, SEEK_SET);
+	write(fd, header, sizeof(header) );
+	write(fd, &corruptLength, sizeof(corruptLength) );
+	lseek(fd, 0, SEEK_SET);
+	printf("Corrupt stream:  %d (expected %d)\n\n", List_read(&readList, fd, employeeDeserialize, employeeDestructor), LIST_ERR_INVALID_ARG);
+
+	fclose(file);
+
+	return(0);
+}
+
 int main (int argc, char *argv[]) {
 	char input[10];
 	char choice;
@@ -90,6 +154,7 @@ int main (int argc, char *argv[]) {
 		printf("[A]dd employee\n");
 		printf("[D]elete employee\n");
 		printf("[L]ist employee(s)\n");
+		printf("[S]tream check\n");
 		printf("[Q]uit\n\n:");
 
 		fgets(input, sizeof(input) - 1, stdin);
@@ -105,6 +170,9 @@ int main (int argc, char *argv[]) {
 			case 'l':
 				listEmployees();
 				break;
+			case 's':
+				streamCheck();
+				break;
 			case 'q':
 				List_destroy(&employeeList);
 				return(0);
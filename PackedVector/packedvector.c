@@ -0,0 +1,265 @@
+#include <string.h>
+#include "packedvector.h"
+
+static const struct _PackedBlock* _block(const PackedVector* packed, long block) {
+	return( (const struct _PackedBlock*) Vector_get(&packed->_blocks, block) );
+}
+
+static const unsigned long* _blockWords(const PackedVector* packed, const struct _PackedBlock* header) {
+	return( (const unsigned long*) Vector_array(&packed->_words) + header->offset);
+}
+
+static unsigned long _mask(int width) {
+	return(width == 64 ? ~0UL : (1UL << width) - 1);
+}
+
+//  Extracts the value at position within a block, which may straddle two words.
+static long _extract(const unsigned long* words, long position, int width, long reference) {
+	long bit = position * width;
+	int shift = bit % 64;
+	unsigned long delta = words[bit / 64] >> shift;
+
+	if(shift + width > 64) {
+		delta |= words[bit / 64 + 1] << (64 - shift);
+	}
+	return( (long) ( (unsigned long) reference + (delta & _mask(width) ) ) );
+}
+
+//  Always inlined into _unpack with a constant width, so that every width gets its own
+//  loop with constant shifts and masks, which the compiler unrolls and vectorizes.
+static inline __attribute__((always_inline)) void _unpackWidth(const unsigned long* words, long* values, long reference, int width) {
+	for(long i = 0; i < PACKEDVECTOR_BLOCK_SIZE; i++) {
+		values[i] = _extract(words, i, width, reference);
+	}
+}
+
+#define _UNPACK_CASE(w)		case w: _unpackWidth(words, values, reference, w); break;
+#define _UNPACK_CASES(w)	_UNPACK_CASE(w + 1) _UNPACK_CASE(w + 2) _UNPACK_CASE(w + 3) _UNPACK_CASE(w + 4)\
+							_UNPACK_CASE(w + 5) _UNPACK_CASE(w + 6) _UNPACK_CASE(w + 7) _UNPACK_CASE(w + 8)
+
+static void _unpack(const unsigned long* words, long* values, long reference, int width) {
+	switch(width) {
+		case 0:
+			for(long i = 0; i < PACKEDVECTOR_BLOCK_SIZE; i++) {
+				values[i] = reference;
+			}
+			break;
+		_UNPACK_CASES(0)  _UNPACK_CASES(8)  _UNPACK_CASES(16) _UNPACK_CASES(24)
+		_UNPACK_CASES(32) _UNPACK_CASES(40) _UNPACK_CASES(48) _UNPACK_CASES(56)
+	}
+}
+
+//  Packs the full tail into a new block.
+static int _packTail(PackedVector* packed) {
+	long minimum = packed->_tail[0];
+	long maximum = packed->_tail[0];
+
+	for(long i = 1; i < PACKEDVECTOR_BLOCK_SIZE; i++) {
+		minimum = (packed->_tail[i] < minimum) ? packed->_tail[i] : minimum;
+		maximum = (packed->_tail[i] > maximum) ? packed->_tail[i] : maximum;
+	}
+	unsigned long range = (unsigned long) maximum - (unsigned long) minimum;
+	struct _PackedBlock header;
+
+	header.reference = minimum;
+	header.maximum = maximum;
+	header.offset = Vector_size(&packed->_words);
+	header.width = (range == 0) ? 0 : 64 - __builtin_clzl(range);
+
+	if(header.width > 0) {
+		long wordCount = PACKEDVECTOR_BLOCK_SIZE / 64 * header.width;
+		//  Emplaced words come from zeroed capacity, so values can be or-ed in.
+		unsigned long* words = (unsigned long*) Vector_emplaceN(&packed->_words, header.offset, wordCount);
+
+		if(words == NULL) {
+			return(PACKEDVECTOR_ERR_ALLOCATION);
+		}
+		for(long i = 0; i < PACKEDVECTOR_BLOCK_SIZE; i++) {
+			unsigned long delta = (unsigned long) packed->_tail[i] - (unsigned long) minimum;
+			long bit = i * header.width;
+			int shift = bit % 64;
+
+			words[bit / 64] |= delta << shift;
+			if(shift + header.width > 64) {
+				words[bit / 64 + 1] |= delta >> (64 - shift);
+			}
+		}
+	}
+	if(Vector_append(&packed->_blocks, &header) != VECTOR_FUNC_SUCCESS) {
+		Vector_truncate(&packed->_words, header.offset);
+		return(PACKEDVECTOR_ERR_ALLOCATION);
+	}
+	packed->_tailSize = 0;
+
+	return(PACKEDVECTOR_FUNC_SUCCESS);
+}
+
+int PackedVector_create(PackedVector* packed, long capacity) {
+	if(packed == NULL) {
+		return(PACKEDVECTOR_ERR_NULL_ARG);
+	}
+	if(capacity < 1) {
+		return(PACKEDVECTOR_ERR_INVALID_ARG);
+	}
+	long blockCapacity = capacity / PACKEDVECTOR_BLOCK_SIZE + 1;
+
+	//  Assume about 8 bits per value until the data says otherwise.
+	Vector_create(&packed->_blocks, blockCapacity, sizeof(struct _PackedBlock), NULL);
+	Vector_create(&packed->_words, blockCapacity * (PACKEDVECTOR_BLOCK_SIZE / 8), sizeof(unsigned long), NULL);
+	if(Vector_array(&packed->_blocks) == NULL || Vector_array(&packed->_words) == NULL) {
+		Vector_destroy(&packed->_blocks);
+		Vector_destroy(&packed->_words);
+		return(PACKEDVECTOR_ERR_ALLOCATION);
+	}
+	packed->_tailSize = 0;
+
+	return(PACKEDVECTOR_FUNC_SUCCESS);
+}
+
+int PackedVector_destroy(PackedVector* packed) {
+	if(packed == NULL) {
+		return(PACKEDVECTOR_ERR_NULL_ARG);
+	}
+	Vector_destroy(&packed->_blocks);
+	Vector_destroy(&packed->_words);
+	packed->_tailSize = 0;
+
+	return(PACKEDVECTOR_FUNC_SUCCESS);
+}
+
+long PackedVector_size(const PackedVector* packed) {
+	if(packed == NULL) {
+		return(PACKEDVECTOR_ERR_NULL_ARG);
+	}
+	return(Vector_size(&packed->_blocks) * PACKEDVECTOR_BLOCK_SIZE + packed->_tailSize);
+}
+
+long PackedVector_bytes(const PackedVector* packed) {
+	if(packed == NULL) {
+		return(PACKEDVECTOR_ERR_NULL_ARG);
+	}
+	return(Vector_size(&packed->_blocks) * sizeof(struct _PackedBlock) +
+	       Vector_size(&packed->_words) * sizeof(unsigned long) + sizeof(packed->_tail) );
+}
+
+int PackedVector_append(PackedVector* packed, long value) {
+	if(packed == NULL) {
+		return(PACKEDVECTOR_ERR_NULL_ARG);
+	}
+	packed->_tail[packed->_tailSize++] = value;
+	if(packed->_tailSize == PACKEDVECTOR_BLOCK_SIZE) {
+		int returnVal = _packTail(packed);
+
+		if(returnVal != PACKEDVECTOR_FUNC_SUCCESS) {
+			packed->_tailSize--;	// Leave the tail as it was.
+			return(returnVal);
+		}
+	}
+	return(PACKEDVECTOR_FUNC_SUCCESS);
+}
+
+int PackedVector_get(const PackedVector* packed, long index, long* value) {
+	if(packed == NULL || value == NULL) {
+		return(PACKEDVECTOR_ERR_NULL_ARG);
+	}
+	if(index < 0 || index >= PackedVector_size(packed) ) {
+		return(PACKEDVECTOR_ERR_OUT_OF_BOUNDS);
+	}
+	long block = index / PACKEDVECTOR_BLOCK_SIZE;
+
+	if(block == Vector_size(&packed->_blocks) ) {
+		*value = packed->_tail[index % PACKEDVECTOR_BLOCK_SIZE];
+		return(PACKEDVECTOR_FUNC_SUCCESS);
+	}
+	const struct _PackedBlock* header = _block(packed, block);
+
+	if(header->width == 0) {
+		*value = header->reference;
+	}
+	else {
+		*value = _extract(_blockWords(packed, header), index % PACKEDVECTOR_BLOCK_SIZE, header->width, header->reference);
+	}
+	return(PACKEDVECTOR_FUNC_SUCCESS);
+}
+
+long PackedVector_blockCount(const PackedVector* packed) {
+	if(packed == NULL) {
+		return(PACKEDVECTOR_ERR_NULL_ARG);
+	}
+	return(Vector_size(&packed->_blocks) + (packed->_tailSize > 0) );
+}
+
+long PackedVector_getBlock(const PackedVector* packed, long block, long* values) {
+	if(packed == NULL || values == NULL) {
+		return(PACKEDVECTOR_ERR_NULL_ARG);
+	}
+	if(block < 0 || block >= PackedVector_blockCount(packed) ) {
+		return(PACKEDVECTOR_ERR_OUT_OF_BOUNDS);
+	}
+	if(block == Vector_size(&packed->_blocks) ) {
+		memcpy(values, packed->_tail, packed->_tailSize * sizeof(long) );
+		return(packed->_tailSize);
+	}
+	const struct _PackedBlock* header = _block(packed, block);
+
+	_unpack(_blockWords(packed, header), values, header->reference, header->width);
+
+	return(PACKEDVECTOR_BLOCK_SIZE);
+}
+
+long PackedVector_lowerBound(const PackedVector* packed, long value) {
+	if(packed == NULL) {
+		return(PACKEDVECTOR_ERR_NULL_ARG);
+	}
+	long low = 0;
+	long high = Vector_size(&packed->_blocks);
+
+	//  First block whose maximum is not less than value.
+	while(low < high) {
+		long middle = low + (high - low) / 2;
+
+		if(_block(packed, middle)->maximum < value) {
+			low = middle + 1;
+		}
+		else {
+			high = middle;
+		}
+	}
+	long values[PACKEDVECTOR_BLOCK_SIZE];
+	long count = (low < PackedVector_blockCount(packed) ) ? PackedVector_getBlock(packed, low, values) : 0;
+
+	for(long i = 0; i < count; i++) {
+		if(values[i] >= value) {
+			return(low * PACKEDVECTOR_BLOCK_SIZE + i);
+		}
+	}
+	return(PackedVector_size(packed) );
+}
+
+int PackedVector_toVector(const PackedVector* packed, Vector* vector) {
+	if(packed == NULL || vector == NULL) {
+		return(PACKEDVECTOR_ERR_NULL_ARG);
+	}
+	long size = PackedVector_size(packed);
+	long blockCount = Vector_size(&packed->_blocks);
+
+	Vector_create(vector, (size > 0) ? size : 1, sizeof(long), NULL);
+
+	long* values = (size > 0) ? (long*) Vector_emplaceN(vector, 0, size) : NULL;
+
+	if(Vector_array(vector) == NULL || (size > 0 && values == NULL) ) {
+		Vector_destroy(vector);
+		return(PACKEDVECTOR_ERR_ALLOCATION);
+	}
+	//  Decode straight into the vector's storage.
+	for(long block = 0; block < blockCount; block++) {
+		const struct _PackedBlock* header = _block(packed, block);
+
+		_unpack(_blockWords(packed, header), values + block * PACKEDVECTOR_BLOCK_SIZE, header->reference, header->width);
+	}
+	if(packed->_tailSize > 0) {
+		memcpy(values + blockCount * PACKEDVECTOR_BLOCK_SIZE, packed->_tail, packed->_tailSize * sizeof(long) );
+	}
+
+	return(PACKEDVECTOR_FUNC_SUCCESS);
+}
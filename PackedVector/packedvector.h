@@ -0,0 +1,156 @@
+#ifndef _PACKEDVECTOR_H_
+#define _PACKEDVECTOR_H_
+
+#include "../Vector/vector.h"
+
+/////////////////////////////////////////////////////////////////////////////////////////
+//  PackedVector function return values
+/////////////////////////////////////////////////////////////////////////////////////////
+#define PACKEDVECTOR_FUNC_SUCCESS		 0	// No error
+#define PACKEDVECTOR_ERR_NULL_ARG		-1	// Required pointer argument is NULL
+#define PACKEDVECTOR_ERR_INVALID_ARG	-2	// An invalid value has been passed to function
+#define PACKEDVECTOR_ERR_ALLOCATION		-3	// Block or word capacity resize has failed
+#define PACKEDVECTOR_ERR_OUT_OF_BOUNDS	-4	// Attempted to access an index out of bounds
+
+/////////////////////////////////////////////////////////////////////////////////////////
+//  Number of values per compressed block. Must be a multiple of 64 so that every block
+//  fills a whole number of words.
+/////////////////////////////////////////////////////////////////////////////////////////
+#define PACKEDVECTOR_BLOCK_SIZE	128
+
+/////////////////////////////////////////////////////////////////////////////////////////
+//  _PackedBlock is the header of one compressed block: each value is stored as its
+//  difference from reference, in width bits. This data structure will be managed
+//  within the PackedVector_... functions and does not require client interaction.
+/////////////////////////////////////////////////////////////////////////////////////////
+struct _PackedBlock
+{
+	long reference;	// Smallest value in the block.
+	long maximum;	// Largest value in the block.
+	long offset;	// Index in _words of the first word of the block.
+	int width;		// Bits per value, 0 to 64; the block holds 2 * width words.
+};
+
+/////////////////////////////////////////////////////////////////////////////////////////
+//  PackedVector is the client-side data structure for a vector of long integers
+//  compressed with block-wise frame-of-reference bit-packing. Values are appended to
+//  an uncompressed tail, which is packed into a block once PACKEDVECTOR_BLOCK_SIZE
+//  values have accumulated. Sorted or clustered data (ids, timestamps) packs to a
+//  small fraction of its plain size while any value stays reachable in O(1). The
+//  members within PackedVector will be managed with the PackedVector_... functions and
+//  do not require client interaction.
+//  Member - _blocks:	Vector of struct _PackedBlock, one per full block.
+//  Member - _words:	Vector of unsigned long holding the packed values of every block.
+//  Member - _tail:		Values appended since the last full block.
+//  Member - _tailSize:	Number of values in _tail.
+/////////////////////////////////////////////////////////////////////////////////////////
+typedef struct _PackedVector {
+	Vector _blocks;
+	Vector _words;
+	long _tail[PACKEDVECTOR_BLOCK_SIZE];
+	long _tailSize;
+} PackedVector;
+
+/////////////////////////////////////////////////////////////////////////////////////////
+//  Initializes and allocates memory for packed vector.
+//
+//  Arg - packed:	Pointer to the packed vector which is being created.
+//  Arg - capacity:	Expected number of values, used to size the initial allocations.
+//
+//  Returns: PACKEDVECTOR_... #defined above.
+/////////////////////////////////////////////////////////////////////////////////////////
+int PackedVector_create(PackedVector* packed, long capacity);
+
+/////////////////////////////////////////////////////////////////////////////////////////
+//  Frees the blocks and words of packed vector.
+//
+//  Arg - packed: Pointer to the packed vector which is being destroyed.
+//
+//  Returns: PACKEDVECTOR_... #defined above.
+/////////////////////////////////////////////////////////////////////////////////////////
+int PackedVector_destroy(PackedVector* packed);
+
+/////////////////////////////////////////////////////////////////////////////////////////
+//  Returns number of values in packed vector.
+//
+//  Arg - packed: Pointer to the packed vector.
+//
+//  Returns: Number of values.
+/////////////////////////////////////////////////////////////////////////////////////////
+long PackedVector_size(const PackedVector* packed);
+
+/////////////////////////////////////////////////////////////////////////////////////////
+//  Returns memory used by the values of packed vector: block headers, packed words and
+//  the uncompressed tail.
+//
+//  Arg - packed: Pointer to the packed vector.
+//
+//  Returns: Size in bytes.
+/////////////////////////////////////////////////////////////////////////////////////////
+long PackedVector_bytes(const PackedVector* packed);
+
+/////////////////////////////////////////////////////////////////////////////////////////
+//  Appends a value to the end of packed vector, compressing the tail into a new block
+//  once it is full.
+//
+//  Arg - packed: Pointer to the packed vector.
+//  Arg - value:  Value to append.
+//
+//  Returns: PACKEDVECTOR_... #defined above.
+/////////////////////////////////////////////////////////////////////////////////////////
+int PackedVector_append(PackedVector* packed, long value);
+
+/////////////////////////////////////////////////////////////////////////////////////////
+//  Decodes the single value at index (after an in-bounds check).
+//
+//  Arg - packed: Pointer to the packed vector.
+//  Arg - index:  Value to fetch.
+//  Arg - value:  Receives the value.
+//
+//  Returns: PACKEDVECTOR_... #defined above.
+/////////////////////////////////////////////////////////////////////////////////////////
+int PackedVector_get(const PackedVector* packed, long index, long* value);
+
+/////////////////////////////////////////////////////////////////////////////////////////
+//  Returns number of blocks, including the partial tail block if it is not empty.
+//
+//  Arg - packed: Pointer to the packed vector.
+//
+//  Returns: Number of blocks.
+/////////////////////////////////////////////////////////////////////////////////////////
+long PackedVector_blockCount(const PackedVector* packed);
+
+/////////////////////////////////////////////////////////////////////////////////////////
+//  Decodes a whole block, for sequential scans or random access by block.
+//
+//  Arg - packed: Pointer to the packed vector.
+//  Arg - block:  Block to decode; it holds values [block * PACKEDVECTOR_BLOCK_SIZE, ...).
+//  Arg - values: Receives up to PACKEDVECTOR_BLOCK_SIZE values.
+//
+//  Returns: Number of values decoded, or PACKEDVECTOR_... #defined above on error.
+/////////////////////////////////////////////////////////////////////////////////////////
+long PackedVector_getBlock(const PackedVector* packed, long block, long* values);
+
+/////////////////////////////////////////////////////////////////////////////////////////
+//  Finds the first value not less than value, binary searching the block headers and
+//  then the one block which can hold it.
+//
+//  Arg - packed: Pointer to the packed vector, whose values must be sorted ascending.
+//  Arg - value:  Value to search for.
+//
+//  Returns: Index of the first value >= value, or the packed vector size if there is
+//           none; or PACKEDVECTOR_... #defined above on error.
+/////////////////////////////////////////////////////////////////////////////////////////
+long PackedVector_lowerBound(const PackedVector* packed, long value);
+
+/////////////////////////////////////////////////////////////////////////////////////////
+//  Decompresses every value, in bulk, into a new vector of long.
+//
+//  Arg - packed: Pointer to the packed vector.
+//  Arg - vector: The vector to create.
+//
+//  Returns: PACKEDVECTOR_... #defined above.
+/////////////////////////////////////////////////////////////////////////////////////////
+int PackedVector_toVector(const PackedVector* packed, Vector* vector);
+
+#endif
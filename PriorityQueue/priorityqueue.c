@@ -0,0 +1,311 @@
+#include "priorityqueue.h"
+
+static inline void* _element(const PriorityQueue* queue, long index) {
+	return(Vector_array(&queue->_heap) + (index * queue->_elementSize) );
+}
+
+static inline void _place(PriorityQueue* queue, long index, long handle, const void* data) {
+	memcpy(_element(queue, index), data, queue->_elementSize);
+	( (long*) Vector_array(&queue->_handles) )[index] = handle;
+	( (long*) Vector_array(&queue->_positions) )[handle] = index;
+}
+
+//  Moves the element in _scratch, whose handle is handle, up from the hole at index.
+static void _siftUp(PriorityQueue* queue, long index, long handle) {
+	long* handles = (long*) Vector_array(&queue->_handles);
+
+	while(index > 0) {
+		long parent = (index - 1) / queue->_arity;
+
+		if(queue->_elementCompare(queue->_scratch, _element(queue, parent) ) >= 0) {
+			break;
+		}
+		_place(queue, index, handles[parent], _element(queue, parent) );
+		index = parent;
+	}
+	_place(queue, index, handle, queue->_scratch);
+}
+
+//  Moves the element in _scratch, whose handle is handle, down from the hole at index.
+static void _siftDown(PriorityQueue* queue, long index, long handle) {
+	long* handles = (long*) Vector_array(&queue->_handles);
+	long size = Vector_size(&queue->_heap);
+
+	while(1) {
+		long first = (index * queue->_arity) + 1;
+		long last = first + queue->_arity;
+		long best = first;
+
+		if(first >= size) {
+			break;
+		}
+		if(last > size) {
+			last = size;
+		}
+		for(long child = first + 1; child < last; child++) {
+			if(queue->_elementCompare(_element(queue, child), _element(queue, best) ) < 0) {
+				best = child;
+			}
+		}
+		if(queue->_elementCompare(_element(queue, best), queue->_scratch) >= 0) {
+			break;
+		}
+		_place(queue, index, handles[best], _element(queue, best) );
+		index = best;
+	}
+	_place(queue, index, handle, queue->_scratch);
+}
+
+//  Moves the element in _scratch into the hole at index, in whichever direction
+//  restores heap order.
+static void _sift(PriorityQueue* queue, long index, long handle) {
+	if(index > 0 && queue->_elementCompare(queue->_scratch, _element(queue, (index - 1) / queue->_arity) ) < 0) {
+		_siftUp(queue, index, handle);
+	}
+	else {
+		_siftDown(queue, index, handle);
+	}
+}
+
+static long _acquireHandle(PriorityQueue* queue) {
+	long handle;
+
+	if(Vector_size(&queue->_freeHandles) > 0) {
+		handle = *(long*) Vector_last(&queue->_freeHandles);
+		Vector_chop(&queue->_freeHandles);
+		return(handle);
+	}
+	long* position = (long*) Vector_emplaceBack(&queue->_positions);
+
+	if(position == NULL) {
+		return(-1);
+	}
+	*position = -1;
+
+	return(Vector_size(&queue->_positions) - 1);
+}
+
+static void _releaseHandle(PriorityQueue* queue, long handle) {
+	( (long*) Vector_array(&queue->_positions) )[handle] = -1;
+	Vector_append(&queue->_freeHandles, &handle);
+}
+
+static long _position(const PriorityQueue* queue, long handle) {
+	if(handle < 0 || handle >= Vector_size(&queue->_positions) ) {
+		return(-1);
+	}
+	return( ( (long*) Vector_array(&queue->_positions) )[handle]);
+}
+
+//  Removes the (already destroyed or moved out) element at index, filling the hole with
+//  the last element and sifting it into place.
+static void _removeIndex(PriorityQueue* queue, long index) {
+	long* handles = (long*) Vector_array(&queue->_handles);
+	long last = Vector_size(&queue->_heap) - 1;
+	long lastHandle = handles[last];
+
+	_releaseHandle(queue, handles[index]);
+
+	if(index != last) {
+		memcpy(queue->_scratch, _element(queue, last), queue->_elementSize);
+	}
+	Vector_chop(&queue->_heap);
+	Vector_chop(&queue->_handles);
+
+	if(index != last) {
+		_sift(queue, index, lastHandle);
+	}
+}
+
+int PriorityQueue_create(PriorityQueue* queue, long capacity, int elementSize, int arity, int (*elementCompare)(void*, void*), int (*elementDestructor)(void*)) {
+	if(queue == NULL || elementCompare == NULL) {
+		return(PRIORITYQUEUE_ERR_NULL_ARG);
+	}
+	if(capacity < 1 || elementSize < 1 || arity < 2) {
+		return(PRIORITYQUEUE_ERR_INVALID_ARG);
+	}
+	queue->_scratch = malloc(elementSize);
+	queue->_elementSize = elementSize;
+	queue->_arity = arity;
+	queue->_elementCompare = elementCompare;
+	queue->_elementDestructor = elementDestructor;
+
+	// The queue calls the destructor itself; the heap vector only moves bytes.
+	Vector_create(&queue->_heap, capacity, elementSize, NULL);
+	Vector_create(&queue->_handles, capacity, sizeof(long), NULL);
+	Vector_create(&queue->_positions, capacity, sizeof(long), NULL);
+	Vector_create(&queue->_freeHandles, 1, sizeof(long), NULL);
+
+	if(queue->_scratch == NULL || Vector_array(&queue->_heap) == NULL || Vector_array(&queue->_handles) == NULL ||\
+	   Vector_array(&queue->_positions) == NULL || Vector_array(&queue->_freeHandles) == NULL) {
+		PriorityQueue_destroy(queue);
+		return(PRIORITYQUEUE_ERR_ALLOCATION);
+	}
+	return(PRIORITYQUEUE_FUNC_SUCCESS);
+}
+
+int PriorityQueue_fromVector(PriorityQueue* queue, Vector* vector, int arity, int (*elementCompare)(void*, void*)) {
+	if(queue == NULL || vector == NULL || elementCompare == NULL) {
+		return(PRIORITYQUEUE_ERR_NULL_ARG);
+	}
+	if(arity < 2 || vector->_storage == VECTOR_STORAGE_MAPPED || vector->_storage == VECTOR_STORAGE_MAPPED_RDONLY) {
+		return(PRIORITYQUEUE_ERR_INVALID_ARG);
+	}
+	long size = Vector_size(vector);
+	int returnVal = PriorityQueue_create(queue, size > 0 ? size : 1, vector->_elementSize, arity, elementCompare, vector->_elementDestructor);
+
+	if(returnVal != PRIORITYQUEUE_FUNC_SUCCESS) {
+		return(returnVal);
+	}
+	if(size > 0 && (Vector_emplaceN(&queue->_handles, 0, size) == NULL || Vector_emplaceN(&queue->_positions, 0, size) == NULL) ) {
+		PriorityQueue_destroy(queue);
+		return(PRIORITYQUEUE_ERR_ALLOCATION);
+	}
+	// Take over the vector storage and leave the vector empty.
+	Vector_destroy(&queue->_heap);
+	queue->_heap = *vector;
+	queue->_heap._elementDestructor = NULL;
+	vector->_data = NULL;
+	vector->_size = 0;
+	vector->_capacity = 0;
+	vector->_storage = VECTOR_STORAGE_HEAP;
+
+	long* handles = (long*) Vector_array(&queue->_handles);
+	long* positions = (long*) Vector_array(&queue->_positions);
+
+	for(long i = 0; i < size; i++) {
+		handles[i] = i;
+		positions[i] = i;
+	}
+	// Bottom-up heap construction, O(n).
+	for(long i = (size - 2) / arity; size > 1 && i >= 0; i--) {
+		memcpy(queue->_scratch, _element(queue, i), queue->_elementSize);
+		_siftDown(queue, i, handles[i]);
+	}
+	return(PRIORITYQUEUE_FUNC_SUCCESS);
+}
+
+int PriorityQueue_destroy(PriorityQueue* queue) {
+	if(queue == NULL) {
+		return(PRIORITYQUEUE_ERR_NULL_ARG);
+	}
+	if(queue->_elementDestructor != NULL) {
+		for(long i = 0; i < Vector_size(&queue->_heap); i++) {
+			queue->_elementDestructor(_element(queue, i) );
+		}
+	}
+	Vector_destroy(&queue->_heap);
+	Vector_destroy(&queue->_handles);
+	Vector_destroy(&queue->_positions);
+	Vector_destroy(&queue->_freeHandles);
+	free(queue->_scratch);
+	queue->_scratch = NULL;
+
+	return(PRIORITYQUEUE_FUNC_SUCCESS);
+}
+
+long PriorityQueue_size(const PriorityQueue* queue) {
+	if(queue == NULL) {
+		return(PRIORITYQUEUE_ERR_NULL_ARG);
+	}
+	return(Vector_size(&queue->_heap) );
+}
+
+int PriorityQueue_push(PriorityQueue* queue, const void* data, long* handle) {
+	if(queue == NULL || data == NULL) {
+		return(PRIORITYQUEUE_ERR_NULL_ARG);
+	}
+	long newHandle = _acquireHandle(queue);
+
+	if(newHandle < 0) {
+		return(PRIORITYQUEUE_ERR_ALLOCATION);
+	}
+	if(Vector_emplaceBack(&queue->_heap) == NULL) {
+		_releaseHandle(queue, newHandle);
+		return(PRIORITYQUEUE_ERR_ALLOCATION);
+	}
+	if(Vector_emplaceBack(&queue->_handles) == NULL) {
+		Vector_chop(&queue->_heap);
+		_releaseHandle(queue, newHandle);
+		return(PRIORITYQUEUE_ERR_ALLOCATION);
+	}
+	memcpy(queue->_scratch, data, queue->_elementSize);
+	_siftUp(queue, Vector_size(&queue->_heap) - 1, newHandle);
+
+	if(handle != NULL) {
+		*handle = newHandle;
+	}
+	return(PRIORITYQUEUE_FUNC_SUCCESS);
+}
+
+void* PriorityQueue_top(const PriorityQueue* queue) {
+	if(queue == NULL || Vector_size(&queue->_heap) == 0) {
+		return(NULL);
+	}
+	return(_element(queue, 0) );
+}
+
+int PriorityQueue_pop(PriorityQueue* queue, void* data) {
+	if(queue == NULL) {
+		return(PRIORITYQUEUE_ERR_NULL_ARG);
+	}
+	if(Vector_size(&queue->_heap) == 0) {
+		return(PRIORITYQUEUE_EMPTY);
+	}
+	if(data != NULL) {
+		memcpy(data, _element(queue, 0), queue->_elementSize);
+	}
+	else if(queue->_elementDestructor != NULL) {
+		queue->_elementDestructor(_element(queue, 0) );
+	}
+	_removeIndex(queue, 0);
+
+	return(PRIORITYQUEUE_FUNC_SUCCESS);
+}
+
+void* PriorityQueue_get(const PriorityQueue* queue, long handle) {
+	if(queue == NULL) {
+		return(NULL);
+	}
+	long index = _position(queue, handle);
+
+	if(index < 0) {
+		return(NULL);
+	}
+	return(_element(queue, index) );
+}
+
+int PriorityQueue_update(PriorityQueue* queue, long handle, const void* data) {
+	if(queue == NULL || data == NULL) {
+		return(PRIORITYQUEUE_ERR_NULL_ARG);
+	}
+	long index = _position(queue, handle);
+
+	if(index < 0) {
+		return(PRIORITYQUEUE_ERR_INVALID_HANDLE);
+	}
+	if(queue->_elementDestructor != NULL) {
+		queue->_elementDestructor(_element(queue, index) );
+	}
+	memcpy(queue->_scratch, data, queue->_elementSize);
+	_sift(queue, index, handle);
+
+	return(PRIORITYQUEUE_FUNC_SUCCESS);
+}
+
+int PriorityQueue_remove(PriorityQueue* queue, long handle) {
+	if(queue == NULL) {
+		return(PRIORITYQUEUE_ERR_NULL_ARG);
+	}
+	long index = _position(queue, handle);
+
+	if(index < 0) {
+		return(PRIORITYQUEUE_ERR_INVALID_HANDLE);
+	}
+	if(queue->_elementDestructor != NULL) {
+		queue->_elementDestructor(_element(queue, index) );
+	}
+	_removeIndex(queue, index);
+
+	return(PRIORITYQUEUE_FUNC_SUCCESS);
+}
@@ -0,0 +1,174 @@
+#ifndef _PRIORITYQUEUE_H_
+#define _PRIORITYQUEUE_H_
+
+#include "../Vector/vector.h"
+
+/////////////////////////////////////////////////////////////////////////////////////////
+//  PriorityQueue function return values
+/////////////////////////////////////////////////////////////////////////////////////////
+#define PRIORITYQUEUE_EMPTY				 1	// Priority queue is empty
+#define PRIORITYQUEUE_FUNC_SUCCESS		 0	// No error
+#define PRIORITYQUEUE_ERR_NULL_ARG		-1	// Required pointer argument is NULL
+#define PRIORITYQUEUE_ERR_INVALID_ARG	-2	// An invalid value has been passed to function
+#define PRIORITYQUEUE_ERR_ALLOCATION	-3	// Heap capacity resize has failed
+#define PRIORITYQUEUE_ERR_INVALID_HANDLE -4	// Handle does not refer to a queued element
+
+/////////////////////////////////////////////////////////////////////////////////////////
+//  Heap arities. Any arity of 2 or more works; a 4-ary heap is shallower and keeps
+//  all children of a node in one or two cache lines, which pays off on large heaps.
+/////////////////////////////////////////////////////////////////////////////////////////
+#define PRIORITYQUEUE_BINARY		2
+#define PRIORITYQUEUE_QUATERNARY	4
+
+/////////////////////////////////////////////////////////////////////////////////////////
+//  PriorityQueue is the client-side data structure for a d-ary heap whose elements
+//  are stored contiguously in a Vector. Every queued element has a handle, stable
+//  while the element is queued, through which it can be read, updated (decrease-key or
+//  increase-key) or removed. The members within PriorityQueue will be managed with the
+//  PriorityQueue_... functions and do not require client interaction.
+//  Member - _heap:			Vector of elements in heap order.
+//  Member - _handles:		Vector of long; handle of the element at each heap index.
+//  Member - _positions:	Vector of long; heap index of each handle, -1 if unused.
+//  Member - _freeHandles:	Vector of long; handles available for reuse.
+//  Member - _scratch:		One element of scratch space used while sifting.
+//  Member - _elementSize:	Size, in bytes, of each individual element in memory.
+//  Member - _arity:		Number of children per heap node.
+//  Member - _elementCompare:	 Client-side compare function. The element for which it
+//								 returns a negative value against all others is on top.
+//  Member - _elementDestructor: Function pointer to client-side element destructor.
+/////////////////////////////////////////////////////////////////////////////////////////
+typedef struct _PriorityQueue {
+	Vector _heap;
+	Vector _handles;
+	Vector _positions;
+	Vector _freeHandles;
+	void* _scratch;
+	int _elementSize;
+	int _arity;
+	int (*_elementCompare)(void*, void*);
+	int (*_elementDestructor)(void*);
+} PriorityQueue;
+
+/////////////////////////////////////////////////////////////////////////////////////////
+//  Initializes and allocates memory for an empty priority queue.
+//
+//  Arg - queue:			 Pointer to the priority queue which is being created.
+//  Arg - capacity:			 Desired initial capacity, in elements.
+//  Arg - elementSize:		 Size, in bytes, of each individual element in memory.
+//  Arg - arity:			 Children per heap node, e.g. PRIORITYQUEUE_QUATERNARY.
+//  Arg - elementCompare:	 Client-side compare function, returns < 0 if the first
+//							 element should leave the queue before the second.
+//  Arg - elementDestructor: Function pointer to client-side element destructor.
+//
+//  Returns: PRIORITYQUEUE_... #defined above.
+/////////////////////////////////////////////////////////////////////////////////////////
+int PriorityQueue_create(PriorityQueue* queue, long capacity, int elementSize, int arity, int (*elementCompare)(void*, void*), int (*elementDestructor)(void*));
+
+/////////////////////////////////////////////////////////////////////////////////////////
+//  Builds a priority queue from the elements of an existing vector in O(n). The vector
+//  storage is taken over rather than copied.
+//
+//  Arg - queue:		  Pointer to the priority queue which is being created.
+//  Arg - vector:		  Vector whose elements are heapified. On success it is left
+//						  empty (as after Vector_destroy) and owns no memory.
+//  Arg - arity:		  Children per heap node.
+//  Arg - elementCompare: Client-side compare function, as for PriorityQueue_create.
+//
+//  Returns: PRIORITYQUEUE_... #defined above. PRIORITYQUEUE_ERR_INVALID_ARG is
+//			 returned for file-backed vectors.
+//
+//  Note: Element i of vector gets handle i.
+/////////////////////////////////////////////////////////////////////////////////////////
+int PriorityQueue_fromVector(PriorityQueue* queue, Vector* vector, int arity, int (*elementCompare)(void*, void*));
+
+/////////////////////////////////////////////////////////////////////////////////////////
+//  Calls the destructor on each queued element and frees all priority queue memory.
+//
+//  Arg - queue: Pointer to the priority queue which is being destroyed.
+//
+//  Returns: PRIORITYQUEUE_... #defined above.
+/////////////////////////////////////////////////////////////////////////////////////////
+int PriorityQueue_destroy(PriorityQueue* queue);
+
+/////////////////////////////////////////////////////////////////////////////////////////
+//  Returns number of elements in priority queue.
+//
+//  Arg - queue: Pointer to the priority queue.
+//
+//  Returns: Number of elements.
+/////////////////////////////////////////////////////////////////////////////////////////
+long PriorityQueue_size(const PriorityQueue* queue);
+
+/////////////////////////////////////////////////////////////////////////////////////////
+//  Copies an element into the priority queue in O(log n).
+//
+//  Arg - queue:  Pointer to the priority queue.
+//  Arg - data:	  Element to push.
+//  Arg - handle: If not NULL, receives the handle of the new element.
+//
+//  Returns: PRIORITYQUEUE_... #defined above.
+/////////////////////////////////////////////////////////////////////////////////////////
+int PriorityQueue_push(PriorityQueue* queue, const void* data, long* handle);
+
+/////////////////////////////////////////////////////////////////////////////////////////
+//  Returns pointer to the top element in O(1).
+//
+//  Arg - queue: Pointer to the priority queue.
+//
+//  Returns: Pointer to the top element, or NULL if the priority queue is empty.
+/////////////////////////////////////////////////////////////////////////////////////////
+void* PriorityQueue_top(const PriorityQueue* queue);
+
+/////////////////////////////////////////////////////////////////////////////////////////
+//  Removes the top element in O(log n).
+//
+//  Arg - queue: Pointer to the priority queue.
+//  Arg - data:	 If not NULL, the top element is copied here and ownership passes to the
+//				 caller. If NULL, the client-side destructor is called on it instead.
+//
+//  Returns: PRIORITYQUEUE_... #defined above.
+/////////////////////////////////////////////////////////////////////////////////////////
+int PriorityQueue_pop(PriorityQueue* queue, void* data);
+
+/////////////////////////////////////////////////////////////////////////////////////////
+//  Returns pointer to the queued element with handle.
+//
+//  Arg - queue:  Pointer to the priority queue.
+//  Arg - handle: Handle returned by PriorityQueue_push.
+//
+//  Returns: Pointer to the element, or NULL if handle is not queued.
+//
+//  Note: The element must not be modified in a way which changes its ordering; use
+//		  PriorityQueue_update for that.
+/////////////////////////////////////////////////////////////////////////////////////////
+void* PriorityQueue_get(const PriorityQueue* queue, long handle);
+
+/////////////////////////////////////////////////////////////////////////////////////////
+//  Overwrites the queued element with handle and restores heap order in O(log n).
+//  This is the decrease-key operation, and works for increasing keys as well.
+//
+//  Arg - queue:  Pointer to the priority queue.
+//  Arg - handle: Handle of the element to overwrite.
+//  Arg - data:	  New element.
+//
+//  Returns: PRIORITYQUEUE_... #defined above.
+//
+//  Note: The client-side destructor is called on the old element before it is
+//		  overwritten. The handle stays the same.
+/////////////////////////////////////////////////////////////////////////////////////////
+int PriorityQueue_update(PriorityQueue* queue, long handle, const void* data);
+
+/////////////////////////////////////////////////////////////////////////////////////////
+//  Removes the queued element with handle in O(log n).
+//
+//  Arg - queue:  Pointer to the priority queue.
+//  Arg - handle: Handle of the element to remove.
+//
+//  Returns: PRIORITYQUEUE_... #defined above.
+//
+//  Note: The client-side destructor is called on the removed element. The handle may
+//		  be reused by a later push.
+/////////////////////////////////////////////////////////////////////////////////////////
+int PriorityQueue_remove(PriorityQueue* queue, long handle);
+
+#endif
@@ -0,0 +1,174 @@
+#include "reclaimer.h"
+
+static void* _reclaim(void* argument) {
+	Reclaimer* reclaimer = (Reclaimer*) argument;
+
+	pthread_mutex_lock(&reclaimer->_mutex);
+	while(1) {
+		while(reclaimer->_count == 0 && !reclaimer->_stopping) {
+			pthread_cond_wait(&reclaimer->_notEmpty, &reclaimer->_mutex);
+		}
+		if(reclaimer->_count == 0) {
+			break;	// Stopping and drained.
+		}
+		// Take every pending job as one batch so callers are not held up by the lock.
+		long batchSize = reclaimer->_count;
+
+		for(long i = 0; i < batchSize; i++) {
+			reclaimer->_batch[i] = reclaimer->_jobs[(reclaimer->_head + i) % reclaimer->_capacity];
+		}
+		reclaimer->_head = (reclaimer->_head + batchSize) % reclaimer->_capacity;
+		reclaimer->_count = 0;
+		reclaimer->_active = batchSize;
+		pthread_cond_broadcast(&reclaimer->_notFull);
+		pthread_mutex_unlock(&reclaimer->_mutex);
+
+		for(long i = 0; i < batchSize; i++) {
+			if(reclaimer->_batch[i].type == RECLAIM_VECTOR) {
+				Vector_destroy(&reclaimer->_batch[i].container.vector);
+			}
+			else {
+				List_destroy(&reclaimer->_batch[i].container.list);
+			}
+		}
+
+		pthread_mutex_lock(&reclaimer->_mutex);
+		reclaimer->_active = 0;
+		if(reclaimer->_count == 0) {
+			pthread_cond_broadcast(&reclaimer->_idle);
+		}
+	}
+	pthread_mutex_unlock(&reclaimer->_mutex);
+
+	return(NULL);
+}
+
+static void _enqueue(Reclaimer* reclaimer, const struct _ReclaimJob* job) {
+	pthread_mutex_lock(&reclaimer->_mutex);
+	while(reclaimer->_count == reclaimer->_capacity) {
+		pthread_cond_wait(&reclaimer->_notFull, &reclaimer->_mutex);
+	}
+	reclaimer->_jobs[(reclaimer->_head + reclaimer->_count) % reclaimer->_capacity] = *job;
+	reclaimer->_count++;
+	pthread_cond_signal(&reclaimer->_notEmpty);
+	pthread_mutex_unlock(&reclaimer->_mutex);
+}
+
+int Reclaimer_create(Reclaimer* reclaimer, long capacity) {
+	if(reclaimer == NULL) {
+		return(RECLAIMER_ERR_NULL_ARG);
+	}
+	if(capacity < 1) {
+		return(RECLAIMER_ERR_INVALID_ARG);
+	}
+	reclaimer->_jobs = (struct _ReclaimJob*) malloc(capacity * sizeof(struct _ReclaimJob) );
+	reclaimer->_batch = (struct _ReclaimJob*) malloc(capacity * sizeof(struct _ReclaimJob) );
+
+	if(reclaimer->_jobs == NULL || reclaimer->_batch == NULL) {
+		free(reclaimer->_jobs);
+		free(reclaimer->_batch);
+		return(RECLAIMER_ERR_ALLOCATION);
+	}
+	reclaimer->_capacity = capacity;
+	reclaimer->_head = 0;
+	reclaimer->_count = 0;
+	reclaimer->_active = 0;
+	reclaimer->_stopping = 0;
+	pthread_mutex_init(&reclaimer->_mutex, NULL);
+	pthread_cond_init(&reclaimer->_notEmpty, NULL);
+	pthread_cond_init(&reclaimer->_notFull, NULL);
+	pthread_cond_init(&reclaimer->_idle, NULL);
+
+	if(pthread_create(&reclaimer->_thread, NULL, _reclaim, reclaimer) != 0) {
+		pthread_mutex_destroy(&reclaimer->_mutex);
+		pthread_cond_destroy(&reclaimer->_notEmpty);
+		pthread_cond_destroy(&reclaimer->_notFull);
+		pthread_cond_destroy(&reclaimer->_idle);
+		free(reclaimer->_jobs);
+		free(reclaimer->_batch);
+		return(RECLAIMER_ERR_ALLOCATION);
+	}
+	return(RECLAIMER_FUNC_SUCCESS);
+}
+
+int Reclaimer_destroy(Reclaimer* reclaimer) {
+	if(reclaimer == NULL) {
+		return(RECLAIMER_ERR_NULL_ARG);
+	}
+	pthread_mutex_lock(&reclaimer->_mutex);
+	reclaimer->_stopping = 1;
+	pthread_cond_signal(&reclaimer->_notEmpty);
+	pthread_mutex_unlock(&reclaimer->_mutex);
+	pthread_join(reclaimer->_thread, NULL);
+
+	pthread_mutex_destroy(&reclaimer->_mutex);
+	pthread_cond_destroy(&reclaimer->_notEmpty);
+	pthread_cond_destroy(&reclaimer->_notFull);
+	pthread_cond_destroy(&reclaimer->_idle);
+	free(reclaimer->_jobs);
+	free(reclaimer->_batch);
+	reclaimer->_jobs = NULL;
+	reclaimer->_batch = NULL;
+
+	return(RECLAIMER_FUNC_SUCCESS);
+}
+
+int Reclaimer_destroyVector(Reclaimer* reclaimer, Vector* vector) {
+	if(reclaimer == NULL || vector == NULL) {
+		return(RECLAIMER_ERR_NULL_ARG);
+	}
+	if(vector->_storage == VECTOR_STORAGE_MAPPED || vector->_storage == VECTOR_STORAGE_MAPPED_RDONLY) {
+		return(RECLAIMER_ERR_INVALID_ARG);
+	}
+	struct _ReclaimJob job;
+
+	job.type = RECLAIM_VECTOR;
+	job.container.vector = *vector;
+
+	// Leave vector as Vector_destroy would.
+	vector->_data = NULL;
+	vector->_size = 0;
+	vector->_capacity = 0;
+	vector->_elementSize = 0;
+	vector->_elementDestructor = NULL;
+	vector->_storage = VECTOR_STORAGE_HEAP;
+
+	_enqueue(reclaimer, &job);
+
+	return(RECLAIMER_FUNC_SUCCESS);
+}
+
+int Reclaimer_destroyList(Reclaimer* reclaimer, LinkedList* list) {
+	if(reclaimer == NULL || list == NULL) {
+		return(RECLAIMER_ERR_NULL_ARG);
+	}
+	if(list->_firstNode == NULL) {
+		return(RECLAIMER_FUNC_SUCCESS);	// Nothing to destroy.
+	}
+	struct _ReclaimJob job;
+
+	job.type = RECLAIM_LIST;
+	job.container.list = *list;
+
+	// Leave list empty, as List_destroy would.
+	list->_firstNode = NULL;
+	list->_lastNode = NULL;
+	list->_curNode = NULL;
+
+	_enqueue(reclaimer, &job);
+
+	return(RECLAIMER_FUNC_SUCCESS);
+}
+
+int Reclaimer_flush(Reclaimer* reclaimer) {
+	if(reclaimer == NULL) {
+		return(RECLAIMER_ERR_NULL_ARG);
+	}
+	pthread_mutex_lock(&reclaimer->_mutex);
+	while(reclaimer->_count > 0 || reclaimer->_active > 0) {
+		pthread_cond_wait(&reclaimer->_idle, &reclaimer->_mutex);
+	}
+	pthread_mutex_unlock(&reclaimer->_mutex);
+
+	return(RECLAIMER_FUNC_SUCCESS);
+}
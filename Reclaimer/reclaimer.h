@@ -0,0 +1,108 @@
+#ifndef _RECLAIMER_H_
+#define _RECLAIMER_H_
+
+#include <pthread.h>
+
+#include "../List/list.h"
+#include "../Vector/vector.h"
+
+/////////////////////////////////////////////////////////////////////////////////////////
+//  Reclaimer function return values
+/////////////////////////////////////////////////////////////////////////////////////////
+#define RECLAIMER_FUNC_SUCCESS		 0	// No error
+#define RECLAIMER_ERR_NULL_ARG		-1	// Required pointer argument is NULL
+#define RECLAIMER_ERR_INVALID_ARG	-2	// An invalid value has been passed to function
+#define RECLAIMER_ERR_ALLOCATION	-3	// Queue allocation or thread creation has failed
+
+/////////////////////////////////////////////////////////////////////////////////////////
+//  _ReclaimJob is a detached container waiting to be destroyed. These are managed
+//  within the Reclaimer_... functions and do not require client interaction.
+/////////////////////////////////////////////////////////////////////////////////////////
+#define RECLAIM_VECTOR	0
+#define RECLAIM_LIST	1
+
+struct _ReclaimJob
+{
+	int type;
+	union {
+		Vector vector;
+		LinkedList list;
+	} container;
+};
+
+/////////////////////////////////////////////////////////////////////////////////////////
+//  Reclaimer owns a background thread which destroys detached Vectors and LinkedLists,
+//  running their element destructors and freeing their memory off the caller's
+//  thread. Pending jobs are kept in a bounded ring buffer; the thread takes every
+//  pending job at once and processes the batch without holding the queue lock. The
+//  members within Reclaimer will be managed with the Reclaimer_... functions and do not
+//  require client interaction.
+//  Member - _jobs:		Ring buffer of pending jobs.
+//  Member - _batch:	Jobs taken by the reclaimer thread.
+//  Member - _capacity:	Maximum number of pending jobs.
+//  Member - _head:		Index of the oldest pending job in _jobs.
+//  Member - _count:	Number of pending jobs.
+//  Member - _active:	Number of jobs in the batch being processed.
+//  Member - _stopping:	Set by Reclaimer_destroy to end the thread once drained.
+/////////////////////////////////////////////////////////////////////////////////////////
+typedef struct _Reclaimer
+{
+	struct _ReclaimJob* _jobs;
+	struct _ReclaimJob* _batch;
+	long _capacity;
+	long _head;
+	long _count;
+	long _active;
+	int _stopping;
+	pthread_t _thread;
+	pthread_mutex_t _mutex;
+	pthread_cond_t _notEmpty;
+	pthread_cond_t _notFull;
+	pthread_cond_t _idle;
+}Reclaimer;
+
+/////////////////////////////////////////////////////////////////////////////////////////
+//  Allocates the job queue and starts the reclaimer thread.
+//  Arg - reclaimer: The reclaimer to create.
+//  Arg - capacity: Maximum number of containers waiting to be destroyed.
+//  Returns: RECLAIMER_... #defined above.
+/////////////////////////////////////////////////////////////////////////////////////////
+int Reclaimer_create(Reclaimer* reclaimer, long capacity);
+
+/////////////////////////////////////////////////////////////////////////////////////////
+//  Destroys every pending container, stops the reclaimer thread and frees the queue.
+//  Arg - reclaimer: The reclaimer to destroy.
+//  Returns: RECLAIMER_... #defined above.
+/////////////////////////////////////////////////////////////////////////////////////////
+int Reclaimer_destroy(Reclaimer* reclaimer);
+
+/////////////////////////////////////////////////////////////////////////////////////////
+//  Detaches the storage of vector in O(1) and queues it to be destroyed, as by
+//  Vector_destroy, on the reclaimer thread.
+//  Arg - reclaimer: The reclaimer.
+//  Arg - vector: The vector to destroy. On return it is in the same state as after
+//              Vector_destroy.
+//  Returns: RECLAIMER_... #defined above. RECLAIMER_ERR_INVALID_ARG is returned for
+//           file-backed vectors, which must be destroyed with Vector_destroy.
+//  Note: If the queue is full the caller waits for the reclaimer thread to make room.
+/////////////////////////////////////////////////////////////////////////////////////////
+int Reclaimer_destroyVector(Reclaimer* reclaimer, Vector* vector);
+
+/////////////////////////////////////////////////////////////////////////////////////////
+//  Detaches the node chain of list in O(1) and queues it to be destroyed, as by
+//  List_destroy, on the reclaimer thread.
+//  Arg - reclaimer: The reclaimer.
+//  Arg - list: The list to destroy. On return it is empty and may be reused.
+//  Returns: RECLAIMER_... #defined above.
+//  Note: If the queue is full the caller waits for the reclaimer thread to make room.
+/////////////////////////////////////////////////////////////////////////////////////////
+int Reclaimer_destroyList(Reclaimer* reclaimer, LinkedList* list);
+
+/////////////////////////////////////////////////////////////////////////////////////////
+//  Waits until every container queued so far has been destroyed.
+//  Arg - reclaimer: The reclaimer.
+//  Returns: RECLAIMER_... #defined above.
+/////////////////////////////////////////////////////////////////////////////////////////
+int Reclaimer_flush(Reclaimer* reclaimer);
+
+#endif
@@ -0,0 +1,305 @@
+#include "snapshotvector.h"
+
+static struct _SnapshotVersion* _allocVersion(long tableCapacity) {
+	struct _SnapshotVersion* version = malloc(sizeof(struct _SnapshotVersion) + (tableCapacity * sizeof(struct _SnapshotChunk*) ) );
+
+	if(version == NULL) {
+		return(NULL);
+	}
+	atomic_init(&version->refCount, 1);
+	version->size = 0;
+	version->chunkCount = 0;
+	version->tableCapacity = tableCapacity;
+	version->nextRetired = NULL;
+
+	return(version);
+}
+
+static void _releaseChunk(struct _SnapshotChunk* chunk) {
+	if(atomic_fetch_sub(&chunk->refCount, 1) == 1) {
+		free(chunk);
+	}
+}
+
+static void _releaseVersion(struct _SnapshotVersion* version) {
+	if(atomic_fetch_sub(&version->refCount, 1) != 1) {
+		return;
+	}
+	for(long i = 0; i < version->chunkCount; i++) {
+		_releaseChunk(version->chunks[i]);
+	}
+	free(version);
+}
+
+//  Gives the writer a working version no reader can reach, copying the chunk table
+//  (but not the chunks) if the working version has been published.
+static int _privateVersion(SnapshotVector* vector) {
+	struct _SnapshotVersion* shared = vector->_working;
+
+	if(atomic_load(&shared->refCount) == 1) {
+		return(SNAPSHOTVECTOR_FUNC_SUCCESS);
+	}
+	struct _SnapshotVersion* version = _allocVersion(shared->chunkCount > 0 ? shared->chunkCount * SNAPSHOTVECTOR_CAPACITY_FACTOR : 1);
+
+	if(version == NULL) {
+		return(SNAPSHOTVECTOR_ERR_ALLOCATION);
+	}
+	version->size = shared->size;
+	version->chunkCount = shared->chunkCount;
+	for(long i = 0; i < shared->chunkCount; i++) {
+		version->chunks[i] = shared->chunks[i];
+		atomic_fetch_add(&version->chunks[i]->refCount, 1);
+	}
+	vector->_working = version;
+	_releaseVersion(shared);
+
+	return(SNAPSHOTVECTOR_FUNC_SUCCESS);
+}
+
+//  Returns chunk at chunkIndex of the (private) working version, copying it first if
+//  it is shared with another version.
+static struct _SnapshotChunk* _privateChunk(SnapshotVector* vector, long chunkIndex) {
+	struct _SnapshotChunk* chunk = vector->_working->chunks[chunkIndex];
+
+	if(atomic_load(&chunk->refCount) == 1) {
+		return(chunk);
+	}
+	long chunkBytes = vector->_chunkElements * vector->_elementSize;
+	struct _SnapshotChunk* copy = malloc(sizeof(struct _SnapshotChunk) + chunkBytes);
+
+	if(copy == NULL) {
+		return(NULL);
+	}
+	atomic_init(&copy->refCount, 1);
+	memcpy(copy->data, chunk->data, chunkBytes);
+	vector->_working->chunks[chunkIndex] = copy;
+	_releaseChunk(chunk);
+
+	return(copy);
+}
+
+int SnapshotVector_create(SnapshotVector* vector, long chunkElements, int elementSize) {
+	if(vector == NULL) {
+		return(SNAPSHOTVECTOR_ERR_NULL_ARG);
+	}
+	if(chunkElements < 1 || elementSize < 1) {
+		return(SNAPSHOTVECTOR_ERR_INVALID_ARG);
+	}
+	struct _SnapshotVersion* version = _allocVersion(1);
+
+	if(version == NULL) {
+		return(SNAPSHOTVECTOR_ERR_ALLOCATION);
+	}
+	atomic_fetch_add(&version->refCount, 1);	// Held by both _current and _working.
+	atomic_init(&vector->_current, version);
+	vector->_working = version;
+	vector->_retired = NULL;
+	vector->_retiredCount = 0;
+	Epoch_create(&vector->_epoch);
+	vector->_chunkElements = chunkElements;
+	vector->_elementSize = elementSize;
+
+	return(SNAPSHOTVECTOR_FUNC_SUCCESS);
+}
+
+int SnapshotVector_destroy(SnapshotVector* vector) {
+	if(vector == NULL) {
+		return(SNAPSHOTVECTOR_ERR_NULL_ARG);
+	}
+	SnapshotVector_reclaim(vector);
+	_releaseVersion(atomic_load(&vector->_current) );
+	_releaseVersion(vector->_working);
+	atomic_store(&vector->_current, NULL);
+	vector->_working = NULL;
+
+	return(SNAPSHOTVECTOR_FUNC_SUCCESS);
+}
+
+long SnapshotVector_size(const SnapshotVector* vector) {
+	if(vector == NULL) {
+		return(SNAPSHOTVECTOR_ERR_NULL_ARG);
+	}
+	return(vector->_working->size);
+}
+
+const void* SnapshotVector_get(const SnapshotVector* vector, long index) {
+	if(vector == NULL) {
+		return(NULL);
+	}
+	if(index < 0 || index >= vector->_working->size) {
+		return(NULL);
+	}
+	return(vector->_working->chunks[index / vector->_chunkElements]->data +\
+	       ( (index % vector->_chunkElements) * vector->_elementSize) );
+}
+
+int SnapshotVector_set(SnapshotVector* vector, const void* data, long index) {
+	if(vector == NULL || data == NULL) {
+		return(SNAPSHOTVECTOR_ERR_NULL_ARG);
+	}
+	if(index < 0 || index >= vector->_working->size) {
+		return(SNAPSHOTVECTOR_ERR_OUT_OF_BOUNDS);
+	}
+	if(_privateVersion(vector) != SNAPSHOTVECTOR_FUNC_SUCCESS) {
+		return(SNAPSHOTVECTOR_ERR_ALLOCATION);
+	}
+	struct _SnapshotChunk* chunk = _privateChunk(vector, index / vector->_chunkElements);
+
+	if(chunk == NULL) {
+		return(SNAPSHOTVECTOR_ERR_ALLOCATION);
+	}
+	memcpy(chunk->data + ( (index % vector->_chunkElements) * vector->_elementSize), data, vector->_elementSize);
+
+	return(SNAPSHOTVECTOR_FUNC_SUCCESS);
+}
+
+int SnapshotVector_append(SnapshotVector* vector, const void* data) {
+	if(vector == NULL || data == NULL) {
+		return(SNAPSHOTVECTOR_ERR_NULL_ARG);
+	}
+	if(_privateVersion(vector) != SNAPSHOTVECTOR_FUNC_SUCCESS) {
+		return(SNAPSHOTVECTOR_ERR_ALLOCATION);
+	}
+	struct _SnapshotVersion* version = vector->_working;
+	struct _SnapshotChunk* chunk;
+	long offset = version->size % vector->_chunkElements;
+
+	if(version->size == version->chunkCount * vector->_chunkElements) {
+		if(version->chunkCount == version->tableCapacity) {
+			// The working version is private here, so its table can be grown in place.
+			long tableCapacity = version->tableCapacity * SNAPSHOTVECTOR_CAPACITY_FACTOR;
+			struct _SnapshotVersion* grown = realloc(version, sizeof(struct _SnapshotVersion) + (tableCapacity * sizeof(struct _SnapshotChunk*) ) );
+
+			if(grown == NULL) {
+				return(SNAPSHOTVECTOR_ERR_ALLOCATION);
+			}
+			grown->tableCapacity = tableCapacity;
+			vector->_working = version = grown;
+		}
+		chunk = malloc(sizeof(struct _SnapshotChunk) + (vector->_chunkElements * vector->_elementSize) );
+		if(chunk == NULL) {
+			return(SNAPSHOTVECTOR_ERR_ALLOCATION);
+		}
+		atomic_init(&chunk->refCount, 1);
+		version->chunks[version->chunkCount++] = chunk;
+	}
+	else {
+		chunk = _privateChunk(vector, version->chunkCount - 1);
+		if(chunk == NULL) {
+			return(SNAPSHOTVECTOR_ERR_ALLOCATION);
+		}
+	}
+	memcpy(chunk->data + (offset * vector->_elementSize), data, vector->_elementSize);
+	version->size++;
+
+	return(SNAPSHOTVECTOR_FUNC_SUCCESS);
+}
+
+int SnapshotVector_chop(SnapshotVector* vector) {
+	if(vector == NULL) {
+		return(SNAPSHOTVECTOR_ERR_NULL_ARG);
+	}
+	if(vector->_working->size == 0) {
+		return(SNAPSHOTVECTOR_EMPTY);
+	}
+	if(_privateVersion(vector) != SNAPSHOTVECTOR_FUNC_SUCCESS) {
+		return(SNAPSHOTVECTOR_ERR_ALLOCATION);
+	}
+	struct _SnapshotVersion* version = vector->_working;
+
+	version->size--;
+	if(version->size == (version->chunkCount - 1) * vector->_chunkElements) {
+		_releaseChunk(version->chunks[--version->chunkCount]);
+	}
+	return(SNAPSHOTVECTOR_FUNC_SUCCESS);
+}
+
+int SnapshotVector_publish(SnapshotVector* vector) {
+	if(vector == NULL) {
+		return(SNAPSHOTVECTOR_ERR_NULL_ARG);
+	}
+	struct _SnapshotVersion* old = atomic_load(&vector->_current);
+
+	if(old == vector->_working) {
+		return(SNAPSHOTVECTOR_FUNC_SUCCESS);
+	}
+	atomic_fetch_add(&vector->_working->refCount, 1);
+	atomic_store(&vector->_current, vector->_working);
+
+	// Readers may still be between loading old and taking a reference to it, so the
+	// reference _current held is only dropped after a grace period.
+	old->nextRetired = vector->_retired;
+	vector->_retired = old;
+	vector->_retiredCount++;
+
+	if(vector->_retiredCount >= SNAPSHOTVECTOR_RETIRE_BATCH) {
+		return(SnapshotVector_reclaim(vector) );
+	}
+	return(SNAPSHOTVECTOR_FUNC_SUCCESS);
+}
+
+int SnapshotVector_reclaim(SnapshotVector* vector) {
+	if(vector == NULL) {
+		return(SNAPSHOTVECTOR_ERR_NULL_ARG);
+	}
+	struct _SnapshotVersion* retired = vector->_retired;
+
+	if(retired == NULL) {
+		return(SNAPSHOTVECTOR_FUNC_SUCCESS);
+	}
+	vector->_retired = NULL;
+	vector->_retiredCount = 0;
+	Epoch_synchronize(&vector->_epoch);	// No reader can still be acquiring a retired version.
+
+	while(retired != NULL) {
+		struct _SnapshotVersion* next = retired->nextRetired;
+
+		_releaseVersion(retired);
+		retired = next;
+	}
+	return(SNAPSHOTVECTOR_FUNC_SUCCESS);
+}
+
+int SnapshotVector_snapshot(SnapshotVector* vector, VectorSnapshot* snapshot) {
+	if(vector == NULL || snapshot == NULL) {
+		return(SNAPSHOTVECTOR_ERR_NULL_ARG);
+	}
+	long token = Epoch_enter(&vector->_epoch);
+
+	snapshot->_version = atomic_load(&vector->_current);
+	atomic_fetch_add(&snapshot->_version->refCount, 1);
+	Epoch_exit(&vector->_epoch, token);
+
+	snapshot->_chunkElements = vector->_chunkElements;
+	snapshot->_elementSize = vector->_elementSize;
+
+	return(SNAPSHOTVECTOR_FUNC_SUCCESS);
+}
+
+int SnapshotVector_release(VectorSnapshot* snapshot) {
+	if(snapshot == NULL || snapshot->_version == NULL) {
+		return(SNAPSHOTVECTOR_ERR_NULL_ARG);
+	}
+	_releaseVersion(snapshot->_version);
+	snapshot->_version = NULL;
+
+	return(SNAPSHOTVECTOR_FUNC_SUCCESS);
+}
+
+long VectorSnapshot_size(const VectorSnapshot* snapshot) {
+	if(snapshot == NULL || snapshot->_version == NULL) {
+		return(SNAPSHOTVECTOR_ERR_NULL_ARG);
+	}
+	return(snapshot->_version->size);
+}
+
+const void* VectorSnapshot_get(const VectorSnapshot* snapshot, long index) {
+	if(snapshot == NULL || snapshot->_version == NULL) {
+		return(NULL);
+	}
+	if(index < 0 || index >= snapshot->_version->size) {
+		return(NULL);
+	}
+	return(snapshot->_version->chunks[index / snapshot->_chunkElements]->data +\
+	       ( (index % snapshot->_chunkElements) * snapshot->_elementSize) );
+}
@@ -0,0 +1,242 @@
+#ifndef _SNAPSHOTVECTOR_H_
+#define _SNAPSHOTVECTOR_H_
+
+#include <stdatomic.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "../Epoch/epoch.h"
+
+/////////////////////////////////////////////////////////////////////////////////////////
+//  SnapshotVector function return values
+/////////////////////////////////////////////////////////////////////////////////////////
+#define SNAPSHOTVECTOR_EMPTY			 1	// Vector is empty
+#define SNAPSHOTVECTOR_FUNC_SUCCESS		 0	// No error
+#define SNAPSHOTVECTOR_ERR_NULL_ARG		-1	// Required pointer argument is NULL
+#define SNAPSHOTVECTOR_ERR_INVALID_ARG	-2	// An invalid value has been passed to function
+#define SNAPSHOTVECTOR_ERR_ALLOCATION	-3	// Chunk or version allocation has failed
+#define SNAPSHOTVECTOR_ERR_OUT_OF_BOUNDS -4	// Attempted to access an index out of bounds
+
+/////////////////////////////////////////////////////////////////////////////////////////
+//  How much larger (as a factor) a version's chunk table is made when it must grow.
+/////////////////////////////////////////////////////////////////////////////////////////
+#define SNAPSHOTVECTOR_CAPACITY_FACTOR	2
+
+/////////////////////////////////////////////////////////////////////////////////////////
+//  Number of retired versions SnapshotVector_publish lets accumulate before it
+//  reclaims them automatically.
+/////////////////////////////////////////////////////////////////////////////////////////
+#define SNAPSHOTVECTOR_RETIRE_BATCH	16
+
+/////////////////////////////////////////////////////////////////////////////////////////
+//  _SnapshotChunk holds _chunkElements contiguous elements and is shared, by reference
+//  count, between every version which has not modified it.
+/////////////////////////////////////////////////////////////////////////////////////////
+struct _SnapshotChunk {
+	atomic_long refCount;
+	char data[];
+};
+
+/////////////////////////////////////////////////////////////////////////////////////////
+//  _SnapshotVersion is one immutable (once published) view of the vector: a table of
+//  chunk pointers plus the element count. These are managed by the SnapshotVector_...
+//  functions and do not require client interaction.
+/////////////////////////////////////////////////////////////////////////////////////////
+struct _SnapshotVersion {
+	atomic_long refCount;
+	long size;
+	long chunkCount;
+	long tableCapacity;
+	struct _SnapshotVersion* nextRetired;
+	struct _SnapshotChunk* chunks[];
+};
+
+/////////////////////////////////////////////////////////////////////////////////////////
+//  SnapshotVector is a vector with a single writer and any number of concurrent readers.
+//  The writer modifies a private working version, copying only the chunks it touches
+//  that are still shared with a published version (chunked copy-on-write), and makes
+//  its changes visible with SnapshotVector_publish. Readers take O(1) reference-counted
+//  snapshots of the published version without locks. Versions replaced by a publish
+//  are reclaimed once no reader can still be acquiring them, using two alternating
+//  reader counters (an RCU-style grace period).
+//  Member - _current:			Published version snapshots are taken from.
+//  Member - _working:			Writer's version. Equal to _current until the next write.
+//  Member - _retired:			Versions replaced by a publish, awaiting a grace period.
+//  Member - _retiredCount:		Number of versions on _retired.
+//  Member - _epoch:			Grace period of readers currently acquiring a snapshot.
+//  Member - _chunkElements:	Number of elements per chunk.
+//  Member - _elementSize:		Size, in bytes, of each individual element in memory.
+/////////////////////////////////////////////////////////////////////////////////////////
+typedef struct _SnapshotVector {
+	struct _SnapshotVersion* _Atomic _current;
+	struct _SnapshotVersion* _working;
+	struct _SnapshotVersion* _retired;
+	long _retiredCount;
+	Epoch _epoch;
+	long _chunkElements;
+	int _elementSize;
+} SnapshotVector;
+
+/////////////////////////////////////////////////////////////////////////////////////////
+//  VectorSnapshot is a reader's immutable view of a SnapshotVector. It stays valid,
+//  even after the SnapshotVector is destroyed, until SnapshotVector_release.
+/////////////////////////////////////////////////////////////////////////////////////////
+typedef struct _VectorSnapshot {
+	struct _SnapshotVersion* _version;
+	long _chunkElements;
+	int _elementSize;
+} VectorSnapshot;
+
+/////////////////////////////////////////////////////////////////////////////////////////
+//  Initializes an empty snapshot vector.
+//
+//  Arg - vector:		 Pointer to the snapshot vector which is being created.
+//  Arg - chunkElements: Number of elements per copy-on-write chunk. Smaller chunks make
+//						 writes after a snapshot cheaper, larger chunks make publishing
+//						 cheaper.
+//  Arg - elementSize:	 Size, in bytes, of each individual element in memory.
+//
+//  Returns: SNAPSHOTVECTOR_... #defined above.
+//
+//  Note: Chunks are copied with memcpy and freed without destructors, so elements must
+//		  not own dynamically allocated memory.
+/////////////////////////////////////////////////////////////////////////////////////////
+int SnapshotVector_create(SnapshotVector* vector, long chunkElements, int elementSize);
+
+/////////////////////////////////////////////////////////////////////////////////////////
+//  Releases the writer's versions and reclaims all retired versions. Outstanding
+//  snapshots remain valid and free their version when released.
+//
+//  Arg - vector: Pointer to the snapshot vector which is being destroyed.
+//
+//  Returns: SNAPSHOTVECTOR_... #defined above.
+//
+//  Note: Must be called by the writer with no reader inside SnapshotVector_snapshot.
+/////////////////////////////////////////////////////////////////////////////////////////
+int SnapshotVector_destroy(SnapshotVector* vector);
+
+/////////////////////////////////////////////////////////////////////////////////////////
+//  Returns number of elements in the writer's working version.
+//
+//  Arg - vector: Pointer to the snapshot vector.
+//
+//  Returns: Number of elements.
+/////////////////////////////////////////////////////////////////////////////////////////
+long SnapshotVector_size(const SnapshotVector* vector);
+
+/////////////////////////////////////////////////////////////////////////////////////////
+//  Returns pointer to element at index in the writer's working version.
+//
+//  Arg - vector: Pointer to the snapshot vector.
+//  Arg - index:  Element to fetch.
+//
+//  Returns: Pointer to element at index, or NULL if out of bounds.
+//
+//  Note: The element may be shared with snapshots and must only be modified through
+//		  SnapshotVector_set.
+/////////////////////////////////////////////////////////////////////////////////////////
+const void* SnapshotVector_get(const SnapshotVector* vector, long index);
+
+/////////////////////////////////////////////////////////////////////////////////////////
+//  Overwrites element at index in the writer's working version.
+//
+//  Arg - vector: Pointer to the snapshot vector being altered.
+//  Arg - data:	  New element to set at index.
+//  Arg - index:  Index position of element to be overwritten by data.
+//
+//  Returns: SNAPSHOTVECTOR_... #defined above.
+//
+//  Note: If the chunk holding index is shared with a published version it is copied
+//		  first. Writer only.
+/////////////////////////////////////////////////////////////////////////////////////////
+int SnapshotVector_set(SnapshotVector* vector, const void* data, long index);
+
+/////////////////////////////////////////////////////////////////////////////////////////
+//  Appends an element to the end of the writer's working version.
+//
+//  Arg - vector: Pointer to the snapshot vector which will be appended.
+//  Arg - data:	  New element which will be appended.
+//
+//  Returns: SNAPSHOTVECTOR_... #defined above.
+//
+//  Note: Writer only.
+/////////////////////////////////////////////////////////////////////////////////////////
+int SnapshotVector_append(SnapshotVector* vector, const void* data);
+
+/////////////////////////////////////////////////////////////////////////////////////////
+//  Removes an element from the end of the writer's working version.
+//
+//  Arg - vector: Pointer to the snapshot vector.
+//
+//  Returns: SNAPSHOTVECTOR_... #defined above.
+//
+//  Note: Writer only.
+/////////////////////////////////////////////////////////////////////////////////////////
+int SnapshotVector_chop(SnapshotVector* vector);
+
+/////////////////////////////////////////////////////////////////////////////////////////
+//  Makes the writer's working version the one new snapshots are taken from. The
+//  previously published version is retired and reclaimed after a grace period.
+//
+//  Arg - vector: Pointer to the snapshot vector.
+//
+//  Returns: SNAPSHOTVECTOR_... #defined above.
+//
+//  Note: Writer only. Publishing is O(1); the next write then copies the chunk table
+//		  (not the chunks) so the published version stays immutable.
+/////////////////////////////////////////////////////////////////////////////////////////
+int SnapshotVector_publish(SnapshotVector* vector);
+
+/////////////////////////////////////////////////////////////////////////////////////////
+//  Waits for a grace period, then drops the references held on retired versions,
+//  freeing those no snapshot still holds.
+//
+//  Arg - vector: Pointer to the snapshot vector.
+//
+//  Returns: SNAPSHOTVECTOR_... #defined above.
+//
+//  Note: Writer only. The wait only covers readers inside SnapshotVector_snapshot,
+//		  which is a handful of instructions, never readers holding snapshots.
+/////////////////////////////////////////////////////////////////////////////////////////
+int SnapshotVector_reclaim(SnapshotVector* vector);
+
+/////////////////////////////////////////////////////////////////////////////////////////
+//  Takes an O(1) snapshot of the published version. Lock-free; safe to call from any
+//  number of threads concurrently with the writer.
+//
+//  Arg - vector:	Pointer to the snapshot vector.
+//  Arg - snapshot: Receives the snapshot.
+//
+//  Returns: SNAPSHOTVECTOR_... #defined above.
+/////////////////////////////////////////////////////////////////////////////////////////
+int SnapshotVector_snapshot(SnapshotVector* vector, VectorSnapshot* snapshot);
+
+/////////////////////////////////////////////////////////////////////////////////////////
+//  Drops a snapshot, freeing its version and chunks if it was the last reference.
+//
+//  Arg - snapshot: Pointer to the snapshot being released.
+//
+//  Returns: SNAPSHOTVECTOR_... #defined above.
+/////////////////////////////////////////////////////////////////////////////////////////
+int SnapshotVector_release(VectorSnapshot* snapshot);
+
+/////////////////////////////////////////////////////////////////////////////////////////
+//  Returns number of elements in snapshot.
+//
+//  Arg - snapshot: Pointer to the snapshot.
+//
+//  Returns: Number of elements.
+/////////////////////////////////////////////////////////////////////////////////////////
+long VectorSnapshot_size(const VectorSnapshot* snapshot);
+
+/////////////////////////////////////////////////////////////////////////////////////////
+//  Returns pointer to element at index in snapshot.
+//
+//  Arg - snapshot: Pointer to the snapshot.
+//  Arg - index:	Element to fetch.
+//
+//  Returns: Pointer to element at index, or NULL if out of bounds.
+/////////////////////////////////////////////////////////////////////////////////////////
+const void* VectorSnapshot_get(const VectorSnapshot* snapshot, long index);
+
+#endif
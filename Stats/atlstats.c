@@ -0,0 +1,56 @@
+#include "atlstats.h"
+
+#ifdef ATL_STATS
+AtlStats atlGlobalStats;
+#endif
+
+int AtlStats_snapshot(AtlStats* stats) {
+	if(stats == NULL) {
+		return(ATLSTATS_ERR_NULL_ARG);
+	}
+#ifdef ATL_STATS
+	// AtlStats is made up only of longs, so it is copied counter by counter.
+	long* counters = (long*) &atlGlobalStats;
+	long* copy = (long*) stats;
+
+	for(unsigned int i = 0; i < sizeof(AtlStats) / sizeof(long); i++) {
+		copy[i] = __atomic_load_n(&counters[i], __ATOMIC_RELAXED);
+	}
+	return(ATLSTATS_FUNC_SUCCESS);
+#else
+	memset(stats, '\0', sizeof(AtlStats) );
+
+	return(ATLSTATS_DISABLED);
+#endif
+}
+
+int AtlStats_reset(void) {
+#ifdef ATL_STATS
+	long* counters = (long*) &atlGlobalStats;
+
+	for(unsigned int i = 0; i < sizeof(AtlStats) / sizeof(long); i++) {
+		__atomic_store_n(&counters[i], 0, __ATOMIC_RELAXED);
+	}
+
+	return(ATLSTATS_FUNC_SUCCESS);
+#else
+	return(ATLSTATS_DISABLED);
+#endif
+}
+
+int AtlStats_dump(const AtlStats* stats, const char* prefix, FILE* stream) {
+	if(stats == NULL || prefix == NULL || stream == NULL) {
+		return(ATLSTATS_ERR_NULL_ARG);
+	}
+	fprintf(stream, "%s_resize_count %ld\n", prefix, stats->resizeCount);
+	fprintf(stream, "%s_resize_bytes_copied %ld\n", prefix, stats->resizeBytesCopied);
+	fprintf(stream, "%s_bytes_moved %ld\n", prefix, stats->bytesMoved);
+	fprintf(stream, "%s_bytes_zeroed %ld\n", prefix, stats->bytesZeroed);
+	fprintf(stream, "%s_node_allocs %ld\n", prefix, stats->nodeAllocs);
+	fprintf(stream, "%s_node_frees %ld\n", prefix, stats->nodeFrees);
+	fprintf(stream, "%s_searches %ld\n", prefix, stats->searches);
+	fprintf(stream, "%s_nodes_visited %ld\n", prefix, stats->nodesVisited);
+	fprintf(stream, "%s_destructor_calls %ld\n", prefix, stats->destructorCalls);
+
+	return(ATLSTATS_FUNC_SUCCESS);
+}
@@ -0,0 +1,91 @@
+#ifndef _ATLSTATS_H_
+#define _ATLSTATS_H_
+
+#include <stdio.h>
+#include <string.h>
+
+/////////////////////////////////////////////////////////////////////////////////////////
+//  AtlStats function return values
+/////////////////////////////////////////////////////////////////////////////////////////
+#define ATLSTATS_DISABLED		 1	// Library was built without ATL_STATS; counters are 0
+#define ATLSTATS_FUNC_SUCCESS	 0	// No error
+#define ATLSTATS_ERR_NULL_ARG	-1	// Required pointer argument is NULL
+
+/////////////////////////////////////////////////////////////////////////////////////////
+//  AtlStats holds the instrumentation counters of container internals. When the
+//  library and its clients are compiled with ATL_STATS defined, every Vector and
+//  LinkedList carries its own AtlStats and all containers also add to a process-wide
+//  AtlStats. Without ATL_STATS the counters and the code updating them are compiled
+//  out entirely; the functions below still exist but report zeros.
+//  Member - resizeCount:		Vector_resizeCapacity calls which changed capacity.
+//  Member - resizeBytesCopied:	Bytes of existing data carried over by reallocations.
+//  Member - bytesMoved:		Bytes shifted by memmove when inserting or removing.
+//  Member - bytesZeroed:		Bytes cleared by memset.
+//  Member - nodeAllocs:		List nodes allocated.
+//  Member - nodeFrees:			List nodes freed.
+//  Member - searches:			List_iteratorTo calls.
+//  Member - nodesVisited:		Nodes compared by List_iteratorTo searches.
+//  Member - destructorCalls:	Client-side element destructor invocations.
+/////////////////////////////////////////////////////////////////////////////////////////
+typedef struct _AtlStats {
+	long resizeCount;
+	long resizeBytesCopied;
+	long bytesMoved;
+	long bytesZeroed;
+	long nodeAllocs;
+	long nodeFrees;
+	long searches;
+	long nodesVisited;
+	long destructorCalls;
+} AtlStats;
+
+#ifdef ATL_STATS
+
+extern AtlStats atlGlobalStats;
+
+#define ATL_STAT_INIT(container)	memset(&(container)->_stats, '\0', sizeof(AtlStats) )
+#define ATL_STAT_ADD(container, field, amount)											\
+	do {																				\
+		(container)->_stats.field += (amount);											\
+		__atomic_fetch_add(&atlGlobalStats.field, (amount), __ATOMIC_RELAXED);			\
+	} while(0)
+
+#else
+
+#define ATL_STAT_INIT(container)				( (void) 0)
+#define ATL_STAT_ADD(container, field, amount)	( (void) 0)
+
+#endif
+
+/////////////////////////////////////////////////////////////////////////////////////////
+//  Copies the process-wide counters.
+//
+//  Arg - stats: Receives the counters.
+//
+//  Returns: ATLSTATS_... #defined above.
+//
+//  Note: Counters are read individually, so a snapshot taken while other threads
+//		  update containers is not atomic as a whole.
+/////////////////////////////////////////////////////////////////////////////////////////
+int AtlStats_snapshot(AtlStats* stats);
+
+/////////////////////////////////////////////////////////////////////////////////////////
+//  Zeroes the process-wide counters.
+//
+//  Returns: ATLSTATS_... #defined above.
+/////////////////////////////////////////////////////////////////////////////////////////
+int AtlStats_reset(void);
+
+/////////////////////////////////////////////////////////////////////////////////////////
+//  Writes counters to stream, one "<prefix>_<counter> <value>" line per counter, which
+//  is the Prometheus text format for untyped metrics.
+//
+//  Arg - stats:  Counters to write, from AtlStats_snapshot, Vector_stats or List_stats.
+//  Arg - prefix: Metric name prefix, e.g. "atl" or "atl_cache_vector".
+//  Arg - stream: Stream to write to.
+//
+//  Returns: ATLSTATS_... #defined above.
+/////////////////////////////////////////////////////////////////////////////////////////
+int AtlStats_dump(const AtlStats* stats, const char* prefix, FILE* stream);
+
+#endif
@@ -10,27 +10,34 @@ Vector employeeList;
 
 int addEmployee() {
 	Employee* employeeArray;
-	Employee newEmployee;
+	Employee* newEmployee;
 	char input[256];
+	char name[256];
+	int id = 0;
+	long index;
 	
 	printf("Name:  ");
 	fgets(input, sizeof(input) - 1, stdin);
-	sscanf(input, "%s", newEmployee.name);
+	sscanf(input, "%255s", name);
 	printf("ID:  ");
 	fgets(input, 4, stdin);
-	sscanf(input, "%d", &newEmployee.id);
-	
-	newEmployee.data = malloc(1024);
+	sscanf(input, "%d", &id);
 
 	employeeArray = (Employee*) Vector_array(&employeeList);
 
-	for(int i = 0; i < Vector_size(&employeeList); i++) {
-		if(employeeArray[i].id > newEmployee.id) {
-			Vector_insert(&employeeList, &newEmployee, i);
-			return(1);
+	for(index = 0; index < Vector_size(&employeeList); index++) {
+		if(employeeArray[index].id > id) {
+			break;
 		}
 	}
-	Vector_append(&employeeList, &newEmployee);
+	// Construct the employee directly in vector storage rather than copying it in.
+	newEmployee = (Employee*) Vector_emplaceAt(&employeeList, index);
+	if(newEmployee == NULL) {
+		return(0);
+	}
+	newEmployee->id = id;
+	strcpy(newEmployee->name, name);
+	newEmployee->data = malloc(1024);
 
 	return(1);
 }
@@ -1,5 +1,330 @@
+#define _GNU_SOURCE	// mremap
+
+#include <errno.h>
+#include <fcntl.h>
+#include <limits.h>
+#include <pthread.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <sys/syscall.h>
+#include <sys/uio.h>
+#include <unistd.h>
+#ifdef __SSE2__
+#include <emmintrin.h>
+#endif
+
 #include "vector.h"
 
+struct _VectorFileHeader {
+	char magic[4];
+	int version;
+	int elementSize;
+	long size;
+	long capacity;
+};
+
+struct _VectorStreamHeader {
+	char magic[4];
+	int version;
+	int elementSize;
+	long count;
+};
+
+struct _PrefaultRange {
+	void* start;
+	long length;
+};
+
+#define _SET_INTERSECT	0
+#define _SET_UNION		1
+#define _SET_DIFFERENCE	2
+
+//  Explicit 2 MB page size for MAP_HUGETLB, from <linux/mman.h>. Without it the kernel
+//  uses the default hugetlb size, which may be 1 GB or 512 MB, and lengths rounded to
+//  VECTOR_HUGE_PAGE_SIZE would no longer unmap or remap.
+#if defined(MAP_HUGETLB) && defined(MAP_HUGE_SHIFT) && !defined(MAP_HUGE_2MB)
+#define MAP_HUGE_2MB	(21 << MAP_HUGE_SHIFT)	// log2(2 MB)
+#endif
+
+//  Memory policy modes from <numaif.h>, which is only installed with libnuma.
+#ifndef MPOL_BIND
+#define MPOL_BIND		2
+#define MPOL_INTERLEAVE	3
+#endif
+
+static int _writeAll(int fd, struct iovec* iov, int iovCount) {
+	while(iovCount > 0) {
+		ssize_t written = writev(fd, iov, iovCount);
+
+		if(written < 0) {
+			if(errno == EINTR) {
+				continue;
+			}
+			return(VECTOR_ERR_IO);
+		}
+		while(iovCount > 0 && written >= (ssize_t) iov->iov_len) {
+			written -= iov->iov_len;
+			iov++;
+			iovCount--;
+		}
+		if(iovCount > 0) {
+			iov->iov_base += written;
+			iov->iov_len -= written;
+		}
+	}
+	return(VECTOR_FUNC_SUCCESS);
+}
+
+static long _readAll(int fd, void* buffer, long size) {
+	long total = 0;
+
+	while(total < size) {
+		ssize_t bytesRead = read(fd, buffer + total, size - total);
+
+		if(bytesRead < 0) {
+			if(errno == EINTR) {
+				continue;
+			}
+			return(-1);
+		}
+		if(bytesRead == 0) {
+			break;	// End of file.
+		}
+		total += bytesRead;
+	}
+	return(total);
+}
+
+static int _readStreamHeader(int fd, struct _VectorStreamHeader* header) {
+	if(_readAll(fd, header, sizeof(*header) ) != sizeof(*header) ) {
+		return(VECTOR_ERR_IO);
+	}
+	if(memcmp(header->magic, VECTOR_STREAM_MAGIC, sizeof(header->magic) ) != 0 ||\
+	   header->version != VECTOR_STREAM_VERSION || header->elementSize < 1 || header->count < 0) {
+		return(VECTOR_ERR_INVALID_ARG);
+	}
+	//  The byte count of the data must not overflow.
+	if(header->count > LONG_MAX / header->elementSize) {
+		return(VECTOR_ERR_INVALID_ARG);
+	}
+	return(VECTOR_FUNC_SUCCESS);
+}
+
+//  The file length of a mapping, header included, must not overflow.
+static int _mappedCapacityValid(long capacity, long elementSize) {
+	return(capacity <= (LONG_MAX - VECTOR_FILE_HEADER_SIZE) / elementSize);
+}
+
+static int _mapData(Vector* vector, long capacity) {
+	int protection = PROT_READ;
+	
+	if(vector->_storage == VECTOR_STORAGE_MAPPED) {
+		protection |= PROT_WRITE;
+	}
+	void* map = mmap(NULL, VECTOR_FILE_HEADER_SIZE + (capacity * vector->_elementSize), protection, MAP_SHARED, vector->_fd, 0);
+
+	if(map == MAP_FAILED) {
+		return(VECTOR_ERR_IO);
+	}
+	vector->_data = map + VECTOR_FILE_HEADER_SIZE;
+	vector->_capacity = capacity;
+
+	return(VECTOR_FUNC_SUCCESS);
+}
+
+static void _unmapData(Vector* vector) {
+	if(vector->_data == NULL) {
+		return;
+	}
+	munmap(vector->_data - VECTOR_FILE_HEADER_SIZE, VECTOR_FILE_HEADER_SIZE + (vector->_capacity * vector->_elementSize) );
+	vector->_data = NULL;
+}
+
+static int _resizeMapping(Vector* vector, long capacity) {
+	long oldCapacity = vector->_capacity;
+
+	if(!_mappedCapacityValid(capacity, vector->_elementSize) ) {
+		return(VECTOR_ERR_ALLOCATION);
+	}
+	if(ftruncate(vector->_fd, VECTOR_FILE_HEADER_SIZE + (capacity * vector->_elementSize) ) != 0) {
+		return(VECTOR_ERR_IO);
+	}
+	_unmapData(vector);
+	if(_mapData(vector, capacity) != VECTOR_FUNC_SUCCESS) {
+		// Fall back to the old mapping so the vector stays usable. Should that fail too,
+		// the vector is left empty and unmapped, which Vector_destroy still handles.
+		if(ftruncate(vector->_fd, VECTOR_FILE_HEADER_SIZE + (oldCapacity * vector->_elementSize) ) != 0 ||\
+		   _mapData(vector, oldCapacity) != VECTOR_FUNC_SUCCESS) {
+			vector->_size = 0;
+			vector->_capacity = 0;
+		}
+		return(VECTOR_ERR_IO);
+	}
+	ATL_STAT_ADD(vector, resizeCount, 1);
+
+	return(VECTOR_FUNC_SUCCESS);
+}
+
+static long _hugeLength(const Vector* vector, long capacity) {
+	long bytes = capacity * vector->_elementSize;
+
+	return( (bytes + VECTOR_HUGE_PAGE_SIZE - 1) / VECTOR_HUGE_PAGE_SIZE * VECTOR_HUGE_PAGE_SIZE);
+}
+
+static void* _prefaultRange(void* argument) {
+	struct _PrefaultRange* range = (struct _PrefaultRange*) argument;
+	long pageSize = sysconf(_SC_PAGESIZE);
+
+	for(long offset = 0; offset < range->length; offset += pageSize) {
+		( (volatile char*) range->start)[offset] = 0;	// Already zero; the write just faults the page in.
+	}
+	return(NULL);
+}
+
+//  Splits [start, start + length) into huge page aligned ranges of at least
+//  VECTOR_PREFAULT_CHUNK bytes and faults them in from up to one thread per CPU.
+static void _prefault(void* start, long length) {
+	long threadCount = length / VECTOR_PREFAULT_CHUNK;
+	long cpuCount = sysconf(_SC_NPROCESSORS_ONLN);
+
+	threadCount = (threadCount > cpuCount) ? cpuCount : threadCount;
+	threadCount = (threadCount > VECTOR_PREFAULT_THREADS) ? VECTOR_PREFAULT_THREADS : threadCount;
+	threadCount = (threadCount < 1) ? 1 : threadCount;
+
+	long step = (length / threadCount + VECTOR_HUGE_PAGE_SIZE - 1) / VECTOR_HUGE_PAGE_SIZE * VECTOR_HUGE_PAGE_SIZE;
+	struct _PrefaultRange ranges[VECTOR_PREFAULT_THREADS];
+	pthread_t threads[VECTOR_PREFAULT_THREADS];
+	int started[VECTOR_PREFAULT_THREADS];
+
+	for(long i = 0; i < threadCount; i++) {
+		ranges[i].start = start + (i * step);
+		ranges[i].length = (length - (i * step) < step) ? length - (i * step) : step;
+		//  The calling thread takes the first range, and any a thread can't be started for.
+		started[i] = (i > 0 && ranges[i].length > 0 && pthread_create(&threads[i], NULL, _prefaultRange, &ranges[i]) == 0);
+	}
+	for(long i = 0; i < threadCount; i++) {
+		if(!started[i]) {
+			_prefaultRange(&ranges[i]);
+		}
+	}
+	for(long i = 0; i < threadCount; i++) {
+		if(started[i]) {
+			pthread_join(threads[i], NULL);
+		}
+	}
+}
+
+//  Applies the huge page, NUMA and prefault settings of vector to a range of its
+//  mapping that has not been touched yet. Settings the system turns down are dropped.
+static void _placeHuge(Vector* vector, void* start, long length) {
+#ifdef MADV_HUGEPAGE
+	if(!(vector->_storageFlags & VECTOR_HUGE_TLB) ) {
+		madvise(start, length, MADV_HUGEPAGE);	// Fails harmlessly if transparent huge pages are off.
+	}
+#endif
+	if(vector->_storageFlags & (VECTOR_NUMA_INTERLEAVE | VECTOR_NUMA_BIND) ) {
+#ifdef SYS_mbind
+		int bind = vector->_storageFlags & VECTOR_NUMA_BIND;
+		unsigned long nodeMask = bind ? 1UL << vector->_numaNode : ~0UL;	// The kernel drops absent nodes.
+
+		if(syscall(SYS_mbind, start, length, bind ? MPOL_BIND : MPOL_INTERLEAVE, &nodeMask, 8 * sizeof(nodeMask), 0) != 0) {
+			vector->_storageFlags &= ~(VECTOR_NUMA_INTERLEAVE | VECTOR_NUMA_BIND);
+		}
+#else
+		vector->_storageFlags &= ~(VECTOR_NUMA_INTERLEAVE | VECTOR_NUMA_BIND);
+#endif
+	}
+	if(vector->_storageFlags & VECTOR_PREFAULT) {
+		_prefault(start, length);
+	}
+}
+
+//  Reserves length bytes of address space starting on a huge page boundary, which
+//  transparent huge pages need, by over-reserving and trimming.
+static void* _reserveAligned(long length, int protection) {
+	void* map = mmap(NULL, length + VECTOR_HUGE_PAGE_SIZE, protection, MAP_PRIVATE | MAP_ANONYMOUS | MAP_NORESERVE, -1, 0);
+
+	if(map == MAP_FAILED) {
+		return(MAP_FAILED);
+	}
+	long head = (VECTOR_HUGE_PAGE_SIZE - ( (unsigned long) map % VECTOR_HUGE_PAGE_SIZE) ) % VECTOR_HUGE_PAGE_SIZE;
+
+	if(head > 0) {
+		munmap(map, head);
+	}
+	munmap(map + head + length, VECTOR_HUGE_PAGE_SIZE - head);
+
+	return(map + head);
+}
+
+//  Makes a new placed mapping of length bytes for vector.
+static void* _mapHuge(Vector* vector, long length) {
+	void* map = MAP_FAILED;
+
+#if defined(MAP_HUGETLB) && defined(MAP_HUGE_2MB)
+	if(vector->_storageFlags & VECTOR_HUGE_TLB) {
+		map = mmap(NULL, length, PROT_READ | PROT_WRITE, MAP_PRIVATE | MAP_ANONYMOUS | MAP_HUGETLB | MAP_HUGE_2MB, -1, 0);
+	}
+#endif
+	if(map == MAP_FAILED) {
+		vector->_storageFlags &= ~VECTOR_HUGE_TLB;	// No reserved huge pages; use transparent ones.
+		void* reservation = _reserveAligned(length, PROT_READ | PROT_WRITE);
+
+		if(reservation != MAP_FAILED) {
+			//  The reservation skipped swap accounting; make the usable part a normal mapping.
+			map = mmap(reservation, length, PROT_READ | PROT_WRITE, MAP_PRIVATE | MAP_ANONYMOUS | MAP_FIXED, -1, 0);
+			if(map == MAP_FAILED) {
+				munmap(reservation, length);
+			}
+		}
+	}
+	if(map != MAP_FAILED) {
+		_placeHuge(vector, map, length);
+	}
+	return(map);
+}
+
+//  Grows huge storage with mremap, which moves page table entries rather than data.
+//  If the mapping can't be remapped it is copied to a new one.
+static int _resizeHuge(Vector* vector, long capacity) {
+	long oldLength = _hugeLength(vector, vector->_capacity);
+	long length = _hugeLength(vector, capacity);
+	void* map = MAP_FAILED;
+
+	if(length > oldLength) {
+		if(vector->_storageFlags & VECTOR_HUGE_TLB) {
+			map = mremap(vector->_data, oldLength, length, MREMAP_MAYMOVE);
+		}
+		else {
+			void* target = _reserveAligned(length, PROT_NONE);
+
+			if(target != MAP_FAILED) {
+				map = mremap(vector->_data, oldLength, length, MREMAP_MAYMOVE | MREMAP_FIXED, target);
+				if(map == MAP_FAILED) {
+					munmap(target, length);
+				}
+			}
+		}
+		if(map != MAP_FAILED) {
+			_placeHuge(vector, map + oldLength, length - oldLength);
+		}
+		else {
+			map = _mapHuge(vector, length);
+			if(map == MAP_FAILED) {
+				return(VECTOR_ERR_ALLOCATION);
+			}
+			memcpy(map, vector->_data, vector->_size * vector->_elementSize);
+			munmap(vector->_data, oldLength);
+			ATL_STAT_ADD(vector, resizeBytesCopied, vector->_size * vector->_elementSize);
+		}
+		vector->_data = map;
+	}
+	vector->_capacity = capacity;	// Otherwise the growth fits in the slack of the last huge page.
+	ATL_STAT_ADD(vector, resizeCount, 1);
+
+	return(VECTOR_FUNC_SUCCESS);
+}
+
 int Vector_create(Vector *vector, long capacity, int elementSize, int (*elementDestructor)(void*)) {
 	if(vector == NULL) {
 		return(VECTOR_ERR_NULL_ARG);
@@ -12,19 +337,187 @@ int Vector_create(Vector *vector, long capacity, int elementSize, int (*elementD
 	vector->_capacity = 0;
 	vector->_elementSize = elementSize;
 	vector->_elementDestructor = elementDestructor;
+	vector->_storage = VECTOR_STORAGE_HEAP;
+	vector->_fd = -1;
+	vector->_storageFlags = 0;
+	vector->_numaNode = -1;
+	ATL_STAT_INIT(vector);
 
 	Vector_resizeCapacity(vector, capacity);
 
 	return(VECTOR_FUNC_SUCCESS);
 } 
 
+int Vector_createHuge(Vector* vector, long capacity, int elementSize, int (*elementDestructor)(void*), int flags, int numaNode) {
+	if(vector == NULL) {
+		return(VECTOR_ERR_NULL_ARG);
+	}
+	if(capacity < 1 || elementSize < 1 || ( (flags & VECTOR_NUMA_BIND) && (numaNode < 0 || numaNode >= 64) ) ) {
+		return(VECTOR_ERR_INVALID_ARG);
+	}
+	vector->_data = NULL;
+	vector->_size = 0;
+	vector->_capacity = 0;
+	vector->_elementSize = elementSize;
+	vector->_elementDestructor = elementDestructor;
+	vector->_storage = VECTOR_STORAGE_HUGE;
+	vector->_fd = -1;
+	vector->_storageFlags = flags;
+	vector->_numaNode = numaNode;
+	ATL_STAT_INIT(vector);
+
+	void* map = _mapHuge(vector, _hugeLength(vector, capacity) );
+
+	if(map == MAP_FAILED) {
+		return(Vector_create(vector, capacity, elementSize, elementDestructor) );
+	}
+	vector->_data = map;
+	vector->_capacity = capacity;
+
+	return(VECTOR_FUNC_SUCCESS);
+}
+
+int Vector_storage(const Vector* vector) {
+	if(vector == NULL) {
+		return(VECTOR_ERR_NULL_ARG);
+	}
+	return(vector->_storage);
+}
+
+int Vector_createMapped(Vector* vector, const char* path, long capacity, int elementSize, int (*elementDestructor)(void*)) {
+	if(vector == NULL || path == NULL) {
+		return(VECTOR_ERR_NULL_ARG);
+	}
+	if(capacity < 1 || elementSize < 1 || !_mappedCapacityValid(capacity, elementSize) ) {
+		return(VECTOR_ERR_INVALID_ARG);
+	}
+	int fd = open(path, O_RDWR | O_CREAT | O_TRUNC, 0644);
+
+	if(fd < 0) {
+		return(VECTOR_ERR_IO);
+	}
+	if(ftruncate(fd, VECTOR_FILE_HEADER_SIZE + (capacity * elementSize) ) != 0) {
+		close(fd);
+		return(VECTOR_ERR_IO);
+	}
+	vector->_size = 0;
+	vector->_elementSize = elementSize;
+	vector->_elementDestructor = elementDestructor;
+	vector->_storage = VECTOR_STORAGE_MAPPED;
+	vector->_fd = fd;
+	vector->_storageFlags = 0;
+	vector->_numaNode = -1;
+	ATL_STAT_INIT(vector);
+
+	if(_mapData(vector, capacity) != VECTOR_FUNC_SUCCESS) {
+		close(fd);
+		vector->_fd = -1;
+		return(VECTOR_ERR_IO);
+	}
+	return(Vector_sync(vector) );
+}
+
+int Vector_mapFile(Vector* vector, const char* path, int readOnly, int (*elementDestructor)(void*)) {
+	if(vector == NULL || path == NULL) {
+		return(VECTOR_ERR_NULL_ARG);
+	}
+	struct _VectorFileHeader header;
+	struct stat fileStat;
+	int fd = open(path, readOnly ? O_RDONLY : O_RDWR);
+
+	if(fd < 0) {
+		return(VECTOR_ERR_IO);
+	}
+	if(fstat(fd, &fileStat) != 0 || pread(fd, &header, sizeof(header), 0) != sizeof(header) ) {
+		close(fd);
+		return(VECTOR_ERR_IO);
+	}
+	if(memcmp(header.magic, VECTOR_FILE_MAGIC, sizeof(header.magic) ) != 0 || header.version != VECTOR_FILE_VERSION ||\
+	   header.elementSize < 1 || header.size < 0 || header.size > header.capacity ||\
+	   !_mappedCapacityValid(header.capacity, header.elementSize) ||\
+	   fileStat.st_size < VECTOR_FILE_HEADER_SIZE + (header.capacity * header.elementSize) ) {
+		close(fd);
+		return(VECTOR_ERR_INVALID_ARG);
+	}
+	vector->_size = header.size;
+	vector->_elementSize = header.elementSize;
+	vector->_elementDestructor = elementDestructor;
+	vector->_storage = readOnly ? VECTOR_STORAGE_MAPPED_RDONLY : VECTOR_STORAGE_MAPPED;
+	vector->_fd = fd;
+	vector->_storageFlags = 0;
+	vector->_numaNode = -1;
+	ATL_STAT_INIT(vector);
+
+	if(_mapData(vector, header.capacity) != VECTOR_FUNC_SUCCESS) {
+		close(fd);
+		vector->_fd = -1;
+		return(VECTOR_ERR_IO);
+	}
+	return(VECTOR_FUNC_SUCCESS);
+}
+
+int Vector_sync(Vector* vector) {
+	if(vector == NULL) {
+		return(VECTOR_ERR_NULL_ARG);
+	}
+	if(vector->_storage == VECTOR_STORAGE_HEAP || vector->_storage == VECTOR_STORAGE_HUGE) {
+		return(VECTOR_ERR_INVALID_ARG);
+	}
+	if(vector->_storage == VECTOR_STORAGE_MAPPED_RDONLY) {
+		return(VECTOR_FUNC_SUCCESS);
+	}
+	if(vector->_data == NULL) {
+		// A failed remap left nothing mapped to sync.
+		return(VECTOR_ERR_IO);
+	}
+	struct _VectorFileHeader* header = vector->_data - VECTOR_FILE_HEADER_SIZE;
+
+	memcpy(header->magic, VECTOR_FILE_MAGIC, sizeof(header->magic) );
+	header->version = VECTOR_FILE_VERSION;
+	header->elementSize = vector->_elementSize;
+	header->size = vector->_size;
+	header->capacity = vector->_capacity;
+
+	if(msync(header, VECTOR_FILE_HEADER_SIZE + (vector->_capacity * vector->_elementSize), MS_SYNC) != 0) {
+		return(VECTOR_ERR_IO);
+	}
+	return(VECTOR_FUNC_SUCCESS);
+}
+
 int Vector_destroy(Vector* vector) {
 	if(vector == NULL) {
 		return(VECTOR_ERR_NULL_ARG);
 	}
-	while(Vector_chop(vector) != VECTOR_EMPTY) {
-	} // vector->_size now 0
-	free(vector->_data);
+	if(vector->_storage == VECTOR_STORAGE_MAPPED || vector->_storage == VECTOR_STORAGE_MAPPED_RDONLY) {
+		int returnVal = Vector_sync(vector);
+
+		_unmapData(vector);
+		close(vector->_fd);
+		vector->_fd = -1;
+		vector->_storage = VECTOR_STORAGE_HEAP;
+		vector->_size = 0;
+		vector->_capacity = 0;
+		vector->_elementSize = 0;
+		vector->_elementDestructor = NULL;
+
+		return(returnVal);
+	}
+	// Memory is freed right after, so unlike Vector_chop there is no point zeroing it.
+	if(vector->_elementDestructor != NULL) {
+		for(long i = vector->_size - 1; i >= 0; i--) {
+			vector->_elementDestructor(vector->_data + (i * vector->_elementSize) );
+		}
+		ATL_STAT_ADD(vector, destructorCalls, vector->_size);
+	}
+	vector->_size = 0;
+	if(vector->_storage == VECTOR_STORAGE_HUGE) {
+		munmap(vector->_data, _hugeLength(vector, vector->_capacity) );
+		vector->_storage = VECTOR_STORAGE_HEAP;
+		vector->_storageFlags = 0;
+	}
+	else {
+		free(vector->_data);
+	}
 	vector->_data = NULL;
 	vector->_capacity = 0;
 	vector->_elementSize = 0;
@@ -33,10 +526,80 @@ int Vector_destroy(Vector* vector) {
 	return(VECTOR_FUNC_SUCCESS);
 }
 
+int Vector_move(Vector* to, Vector* from) {
+	if(to == NULL || from == NULL) {
+		return(VECTOR_ERR_NULL_ARG);
+	}
+	*to = *from;
+	from->_data = NULL;
+	from->_size = 0;
+	from->_capacity = 0;
+	from->_elementSize = 0;
+	from->_elementDestructor = NULL;
+	from->_storage = VECTOR_STORAGE_HEAP;
+	from->_fd = -1;
+	from->_storageFlags = 0;
+	from->_numaNode = -1;
+
+	return(VECTOR_FUNC_SUCCESS);
+}
+
+int Vector_swap(Vector* a, Vector* b) {
+	if(a == NULL || b == NULL) {
+		return(VECTOR_ERR_NULL_ARG);
+	}
+	Vector temp = *a;
+
+	*a = *b;
+	*b = temp;
+
+	return(VECTOR_FUNC_SUCCESS);
+}
+
+int Vector_clone(Vector* clone, const Vector* vector, int (*elementCopy)(void*, const void*)) {
+	if(clone == NULL || vector == NULL) {
+		return(VECTOR_ERR_NULL_ARG);
+	}
+	long capacity = (vector->_size > 0) ? vector->_size : 1;
+	int returnVal;
+
+	if(vector->_storage == VECTOR_STORAGE_HUGE) {
+		returnVal = Vector_createHuge(clone, capacity, vector->_elementSize, vector->_elementDestructor, vector->_storageFlags, vector->_numaNode);
+	}
+	else {
+		returnVal = Vector_create(clone, capacity, vector->_elementSize, vector->_elementDestructor);
+	}
+	if(returnVal != VECTOR_FUNC_SUCCESS) {
+		return(returnVal);
+	}
+	if(clone->_data == NULL) {
+		return(VECTOR_ERR_ALLOCATION);
+	}
+	if(elementCopy == NULL) {
+		memcpy(clone->_data, vector->_data, vector->_size * vector->_elementSize);
+		clone->_size = vector->_size;
+		return(VECTOR_FUNC_SUCCESS);
+	}
+	for(long i = 0; i < vector->_size; i++) {
+		returnVal = elementCopy(clone->_data + (i * clone->_elementSize), vector->_data + (i * vector->_elementSize) );
+		if(returnVal != 0) {
+			clone->_size = i;	// Destroy only what was copied.
+			Vector_destroy(clone);
+			return(returnVal);
+		}
+	}
+	clone->_size = vector->_size;
+
+	return(VECTOR_FUNC_SUCCESS);
+}
+
 int Vector_resize(Vector* vector, const void* initData, long size) {
 	if(vector == NULL || (initData == NULL && vector->_size < size)) {
 		return(VECTOR_ERR_NULL_ARG);
 	}
+	if(vector->_storage == VECTOR_STORAGE_MAPPED_RDONLY) {
+		return(VECTOR_ERR_READ_ONLY);
+	}
 	if(size < 1) {
 		return(VECTOR_ERR_INVALID_ARG);
 	}
@@ -56,10 +619,19 @@ int Vector_resizeCapacity(Vector* vector, long capacity) {
 	if(vector == NULL) {
 		return(VECTOR_ERR_NULL_ARG);
 	}
+	if(vector->_storage == VECTOR_STORAGE_MAPPED_RDONLY) {
+		return(VECTOR_ERR_READ_ONLY);
+	}
 	if(capacity <= vector->_capacity) {
 		return(VECTOR_ERR_INVALID_ARG);
 	}
-	int oldCapacity = vector->_capacity;
+	if(vector->_storage == VECTOR_STORAGE_MAPPED) {
+		return(_resizeMapping(vector, capacity) );	// ftruncate zero-fills the new region.
+	}
+	if(vector->_storage == VECTOR_STORAGE_HUGE) {
+		return(_resizeHuge(vector, capacity) );		// New anonymous pages are zero.
+	}
+	long oldCapacity = vector->_capacity;
 	void* newData = realloc(vector->_data, capacity * vector->_elementSize);
 
 	if(newData == NULL) {
@@ -68,6 +640,9 @@ int Vector_resizeCapacity(Vector* vector, long capacity) {
 	vector->_data = newData;
 	vector->_capacity = capacity;
 	memset(vector->_data + (oldCapacity * vector->_elementSize), '\0', (capacity - oldCapacity) * vector->_elementSize);
+	ATL_STAT_ADD(vector, resizeCount, 1);
+	ATL_STAT_ADD(vector, resizeBytesCopied, (long) oldCapacity * vector->_elementSize);
+	ATL_STAT_ADD(vector, bytesZeroed, (capacity - oldCapacity) * vector->_elementSize);
 	
 	return(VECTOR_FUNC_SUCCESS);
 }
@@ -107,11 +682,15 @@ int Vector_set(Vector* vector, const void* data, long index) {
 	if(vector == NULL || data == NULL) {
 		return(VECTOR_ERR_NULL_ARG);
 	}
+	if(vector->_storage == VECTOR_STORAGE_MAPPED_RDONLY) {
+		return(VECTOR_ERR_READ_ONLY);
+	}
 	if(index < 0 || index >= vector->_size) {
 		return(VECTOR_ERR_OUT_OF_BOUNDS);
 	}
 	if(vector->_elementDestructor != NULL) {
 		vector->_elementDestructor(vector->_data + ( index * vector->_elementSize) );
+		ATL_STAT_ADD(vector, destructorCalls, 1);
 	}
 	memcpy(vector->_data + (index * vector->_elementSize), data, vector->_elementSize);
 
@@ -136,6 +715,9 @@ int Vector_append(Vector* vector, const void* data) {
 	if(vector == NULL || data == NULL) {
 		return(VECTOR_ERR_NULL_ARG);
 	}
+	if(vector->_storage == VECTOR_STORAGE_MAPPED_RDONLY) {
+		return(VECTOR_ERR_READ_ONLY);
+	}
 	if(vector->_capacity == vector->_size) {
 		Vector_resizeCapacity(vector, (vector->_size + 1) * CAPACITY_FACTOR);
 	}
@@ -149,15 +731,20 @@ int Vector_chop(Vector* vector) {
 	if(vector == NULL) {
 		return(VECTOR_ERR_NULL_ARG);
 	}
+	if(vector->_storage == VECTOR_STORAGE_MAPPED_RDONLY) {
+		return(VECTOR_ERR_READ_ONLY);
+	}
 	if( vector->_size == 0 ) {
 		return(VECTOR_EMPTY);
 	}
 	if(vector->_elementDestructor != NULL) {
 		vector->_elementDestructor(vector->_data + ( (vector->_size - 1) * vector->_elementSize) );
+		ATL_STAT_ADD(vector, destructorCalls, 1);
 	}
 	vector->_size--;
 
 	memset(vector->_data + (vector->_size * vector->_elementSize), '\0', vector->_elementSize);
+	ATL_STAT_ADD(vector, bytesZeroed, vector->_elementSize);
 
 	return(VECTOR_FUNC_SUCCESS);
 }
@@ -166,6 +753,9 @@ int Vector_insert(Vector* vector, const void* data, long index) {
 	if(vector == NULL || data == NULL) {
 		return (VECTOR_ERR_NULL_ARG);
 	}
+	if(vector->_storage == VECTOR_STORAGE_MAPPED_RDONLY) {
+		return(VECTOR_ERR_READ_ONLY);
+	}
 	if(index < 0 || index >= vector->_size) {
 		return(VECTOR_ERR_OUT_OF_BOUNDS);
 	}
@@ -175,6 +765,7 @@ int Vector_insert(Vector* vector, const void* data, long index) {
 	memmove(vector->_data + ( (index + 1) * vector->_elementSize),\
 	        vector->_data + (index        * vector->_elementSize),\
 	        (vector->_size - index) * vector->_elementSize);
+	ATL_STAT_ADD(vector, bytesMoved, (vector->_size - index) * vector->_elementSize);
 	memcpy(vector->_data + (index * vector->_elementSize), data, vector->_elementSize);
 
 	vector->_size++;
@@ -186,18 +777,493 @@ int Vector_remove(Vector* vector, long index) {
 	if(vector == NULL) {
 		return (VECTOR_ERR_NULL_ARG);
 	}
+	if(vector->_storage == VECTOR_STORAGE_MAPPED_RDONLY) {
+		return(VECTOR_ERR_READ_ONLY);
+	}
 	if(index < 0 || index >= vector->_size) {
 		return(VECTOR_ERR_OUT_OF_BOUNDS);
 	}
 	if(vector->_elementDestructor != NULL) {
 		vector->_elementDestructor(vector->_data + (index * vector->_elementSize) );
+		ATL_STAT_ADD(vector, destructorCalls, 1);
 	}
 	memmove(vector->_data + (index        * vector->_elementSize),\
 	        vector->_data + ( (index + 1) * vector->_elementSize),\
 	        (vector->_size - (index + 1) ) * vector->_elementSize);
+	ATL_STAT_ADD(vector, bytesMoved, (vector->_size - (index + 1) ) * vector->_elementSize);
 	vector->_size--;
 
 	memset(vector->_data + (vector->_size * vector->_elementSize), '\0', vector->_elementSize);
+	ATL_STAT_ADD(vector, bytesZeroed, vector->_elementSize);
 	
 	return(VECTOR_FUNC_SUCCESS);
+}
+
+void* Vector_emplaceN(Vector* vector, long index, long count) {
+	if(vector == NULL || vector->_storage == VECTOR_STORAGE_MAPPED_RDONLY) {
+		return(NULL);
+	}
+	if(index < 0 || index > vector->_size || count < 1) {
+		return(NULL);
+	}
+	if(vector->_size + count > vector->_capacity) {
+		if(Vector_resizeCapacity(vector, (vector->_size + count) * CAPACITY_FACTOR) != VECTOR_FUNC_SUCCESS) {
+			return(NULL);
+		}
+	}
+	if(index < vector->_size) {
+		memmove(vector->_data + ( (index + count) * vector->_elementSize),\
+		        vector->_data + (index            * vector->_elementSize),\
+		        (vector->_size - index) * vector->_elementSize);
+		ATL_STAT_ADD(vector, bytesMoved, (vector->_size - index) * vector->_elementSize);
+	}
+	vector->_size += count;
+
+	return(vector->_data + (index * vector->_elementSize) );
+}
+
+void* Vector_emplaceAt(Vector* vector, long index) {
+	return(Vector_emplaceN(vector, index, 1) );
+}
+
+void* Vector_emplaceBack(Vector* vector) {
+	if(vector == NULL) {
+		return(NULL);
+	}
+	return(Vector_emplaceN(vector, vector->_size, 1) );
+}
+
+int Vector_truncate(Vector* vector, long size) {
+	if(vector == NULL) {
+		return(VECTOR_ERR_NULL_ARG);
+	}
+	if(vector->_storage == VECTOR_STORAGE_MAPPED_RDONLY) {
+		return(VECTOR_ERR_READ_ONLY);
+	}
+	if(size < 0 || size > vector->_size) {
+		return(VECTOR_ERR_OUT_OF_BOUNDS);
+	}
+	if(vector->_elementDestructor != NULL) {
+		for(long i = size; i < vector->_size; i++) {
+			vector->_elementDestructor(vector->_data + (i * vector->_elementSize) );
+		}
+		ATL_STAT_ADD(vector, destructorCalls, vector->_size - size);
+	}
+	memset(vector->_data + (size * vector->_elementSize), '\0', (vector->_size - size) * vector->_elementSize);
+	ATL_STAT_ADD(vector, bytesZeroed, (vector->_size - size) * vector->_elementSize);
+	vector->_size = size;
+
+	return(VECTOR_FUNC_SUCCESS);
+}
+
+int Vector_stats(const Vector* vector, AtlStats* stats) {
+	if(vector == NULL || stats == NULL) {
+		return(ATLSTATS_ERR_NULL_ARG);
+	}
+#ifdef ATL_STATS
+	memcpy(stats, &vector->_stats, sizeof(AtlStats) );
+
+	return(ATLSTATS_FUNC_SUCCESS);
+#else
+	memset(stats, '\0', sizeof(AtlStats) );
+
+	return(ATLSTATS_DISABLED);
+#endif
+}
+
+int Vector_write(const Vector* vector, int fd) {
+	if(vector == NULL) {
+		return(VECTOR_ERR_NULL_ARG);
+	}
+	struct _VectorStreamHeader header;
+	struct iovec iov[2];
+
+	memset(&header, '\0', sizeof(header) );
+	memcpy(header.magic, VECTOR_STREAM_MAGIC, sizeof(header.magic) );
+	header.version = VECTOR_STREAM_VERSION;
+	header.elementSize = vector->_elementSize;
+	header.count = vector->_size;
+
+	iov[0].iov_base = &header;
+	iov[0].iov_len = sizeof(header);
+	iov[1].iov_base = vector->_data;
+	iov[1].iov_len = vector->_size * vector->_elementSize;
+
+	return(_writeAll(fd, iov, 2) );
+}
+
+int Vector_read(Vector* vector, int fd, int (*elementDestructor)(void*)) {
+	if(vector == NULL) {
+		return(VECTOR_ERR_NULL_ARG);
+	}
+	struct _VectorStreamHeader header;
+	int returnVal = _readStreamHeader(fd, &header);
+
+	if(returnVal != VECTOR_FUNC_SUCCESS) {
+		return(returnVal);
+	}
+	returnVal = Vector_create(vector, header.count > 0 ? header.count : 1, header.elementSize, elementDestructor);
+	if(returnVal != VECTOR_FUNC_SUCCESS) {
+		return(returnVal);
+	}
+	if(vector->_data == NULL) {
+		Vector_destroy(vector);
+		return(VECTOR_ERR_ALLOCATION);
+	}
+	long payloadSize = header.count * header.elementSize;
+
+	if(_readAll(fd, vector->_data, payloadSize) != payloadSize) {
+		memset(vector->_data, '\0', payloadSize);	// Don't hand partial elements to destructor.
+		Vector_destroy(vector);
+		return(VECTOR_ERR_IO);
+	}
+	vector->_size = header.count;
+
+	return(VECTOR_FUNC_SUCCESS);
+}
+
+int Vector_readStream(int fd, int (*elementCallback)(const void*, void*), void* context) {
+	if(elementCallback == NULL) {
+		return(VECTOR_ERR_NULL_ARG);
+	}
+	struct _VectorStreamHeader header;
+	int returnVal = _readStreamHeader(fd, &header);
+
+	if(returnVal != VECTOR_FUNC_SUCCESS) {
+		return(returnVal);
+	}
+	long chunkElements = VECTOR_IO_CHUNK_SIZE / header.elementSize;
+
+	if(chunkElements < 1) {
+		chunkElements = 1;
+	}
+	if(chunkElements > header.count) {
+		chunkElements = header.count > 0 ? header.count : 1;
+	}
+	void* chunk = malloc(chunkElements * header.elementSize);
+
+	if(chunk == NULL) {
+		return(VECTOR_ERR_ALLOCATION);
+	}
+	long remaining = header.count;
+
+	while(remaining > 0 && returnVal == VECTOR_FUNC_SUCCESS) {
+		long elements = remaining < chunkElements ? remaining : chunkElements;
+
+		if(_readAll(fd, chunk, elements * header.elementSize) != elements * header.elementSize) {
+			returnVal = VECTOR_ERR_IO;
+			break;
+		}
+		for(long i = 0; i < elements && returnVal == VECTOR_FUNC_SUCCESS; i++) {
+			returnVal = elementCallback(chunk + (i * header.elementSize), context);
+		}
+		remaining -= elements;
+	}
+	free(chunk);
+
+	return(returnVal);
+}
+
+//  The set operation helpers below are always inlined with a constant key size, so each
+//  key size gets its own code without writing it twice.
+static inline __attribute__((always_inline)) long _key(const void* keys, long index, int size) {
+	return(size == 4 ? (long) ( (const int*) keys)[index] : ( (const long*) keys)[index]);
+}
+
+static inline __attribute__((always_inline)) void _storeKey(void* keys, long index, long key, int size) {
+	if(size == 4) {
+		( (int*) keys)[index] = (int) key;
+	}
+	else {
+		( (long*) keys)[index] = key;
+	}
+}
+
+//  Returns the first index from from on whose key is not less than key, probing
+//  from + 1, 3, 7, ... before binary searching the last step, so the cost grows with
+//  the log of the distance moved rather than of count.
+static inline __attribute__((always_inline)) long _gallop(const void* keys, long from, long count, long key, int size) {
+	long low = from;
+	long step = 1;
+
+	while(from + step - 1 < count && _key(keys, from + step - 1, size) < key) {
+		low = from + step;
+		step <<= 1;
+	}
+	long high = (from + step - 1 < count) ? from + step - 1 : count;
+
+	while(low < high) {
+		long middle = low + (high - low) / 2;
+
+		if(_key(keys, middle, size) < key) {
+			low = middle + 1;
+		}
+		else {
+			high = middle;
+		}
+	}
+	return(low);
+}
+
+//  Emits the keys of a from i on which are (or, for a difference, are not) in b, with
+//  a plain merge. The low bits of matched flag keys from i on already found in b.
+static inline __attribute__((always_inline)) long _matchTail(const void* a, long i, long na, const void* b, long j, long nb,\
+                                                             void* out, long k, int matched, int difference, int size) {
+	for(; i < na; i++, matched >>= 1) {
+		long key = _key(a, i, size);
+
+		while(j < nb && _key(b, j, size) < key) {
+			j++;
+		}
+		if( ( (matched & 1) || (j < nb && _key(b, j, size) == key) ) != difference) {
+			_storeKey(out, k++, key, size);
+		}
+	}
+	return(k);
+}
+
+#ifdef __SSE2__
+//  Block kernels: every key of a block of a is compared with every key of a block of b
+//  at once, by comparing against each rotation of the b block. Matches accumulate in
+//  matched until the a block is done, then its keys are written branch-free (the write
+//  always happens, the count only advances for kept keys, hence the result slack).
+static long _matchBlocks32(const int* a, long na, const int* b, long nb, int* out, int difference) {
+	long i = 0;
+	long j = 0;
+	long k = 0;
+	int matched = 0;
+
+	while(i + 4 <= na && j + 4 <= nb) {
+		__m128i va = _mm_loadu_si128( (const __m128i*) (a + i) );
+		__m128i vb = _mm_loadu_si128( (const __m128i*) (b + j) );
+		__m128i equal = _mm_or_si128(_mm_or_si128(_mm_cmpeq_epi32(va, vb),
+		                                          _mm_cmpeq_epi32(va, _mm_shuffle_epi32(vb, _MM_SHUFFLE(0, 3, 2, 1) ) ) ),
+		                             _mm_or_si128(_mm_cmpeq_epi32(va, _mm_shuffle_epi32(vb, _MM_SHUFFLE(1, 0, 3, 2) ) ),
+		                                          _mm_cmpeq_epi32(va, _mm_shuffle_epi32(vb, _MM_SHUFFLE(2, 1, 0, 3) ) ) ) );
+		int aLast = a[i + 3];
+		int bLast = b[j + 3];
+
+		matched |= _mm_movemask_ps(_mm_castsi128_ps(equal) );
+		if(aLast <= bLast) {
+			for(int lane = 0; lane < 4; lane++) {
+				out[k] = a[i + lane];
+				k += ( (matched >> lane) & 1) ^ difference;
+			}
+			i += 4;
+			matched = 0;
+		}
+		if(bLast <= aLast) {
+			j += 4;
+		}
+	}
+	return(_matchTail(a, i, na, b, j, nb, out, k, matched, difference, 4) );
+}
+
+//  SSE2 has no 64-bit compare; two keys are equal when both of their halves are.
+static inline __m128i _equal64(__m128i x, __m128i y) {
+	__m128i equal = _mm_cmpeq_epi32(x, y);
+
+	return(_mm_and_si128(equal, _mm_shuffle_epi32(equal, _MM_SHUFFLE(2, 3, 0, 1) ) ) );
+}
+
+static long _matchBlocks64(const long* a, long na, const long* b, long nb, long* out, int difference) {
+	long i = 0;
+	long j = 0;
+	long k = 0;
+	int matched = 0;
+
+	while(i + 2 <= na && j + 2 <= nb) {
+		__m128i va = _mm_loadu_si128( (const __m128i*) (a + i) );
+		__m128i vb = _mm_loadu_si128( (const __m128i*) (b + j) );
+		__m128i equal = _mm_or_si128(_equal64(va, vb), _equal64(va, _mm_shuffle_epi32(vb, _MM_SHUFFLE(1, 0, 3, 2) ) ) );
+		long aLast = a[i + 1];
+		long bLast = b[j + 1];
+
+		matched |= _mm_movemask_pd(_mm_castsi128_pd(equal) );
+		if(aLast <= bLast) {
+			out[k] = a[i];
+			k += (matched & 1) ^ difference;
+			out[k] = a[i + 1];
+			k += ( (matched >> 1) & 1) ^ difference;
+			i += 2;
+			matched = 0;
+		}
+		if(bLast <= aLast) {
+			j += 2;
+		}
+	}
+	return(_matchTail(a, i, na, b, j, nb, out, k, matched, difference, 8) );
+}
+#endif
+
+static inline __attribute__((always_inline)) long _matchBlocks(const void* a, long na, const void* b, long nb, void* out, int difference, int size) {
+#ifdef __SSE2__
+	if(size == 4) {
+		return(_matchBlocks32(a, na, b, nb, out, difference) );
+	}
+	return(_matchBlocks64(a, na, b, nb, out, difference) );
+#else
+	return(_matchTail(a, 0, na, b, 0, nb, out, 0, 0, difference, size) );
+#endif
+}
+
+//  Keys of small which are in large, galloping through large.
+static inline __attribute__((always_inline)) long _intersectGallop(const void* small, long ns, const void* large, long nl, void* out, int size) {
+	long j = 0;
+	long k = 0;
+
+	for(long i = 0; i < ns && j < nl; i++) {
+		long key = _key(small, i, size);
+
+		j = _gallop(large, j, nl, key, size);
+		if(j < nl && _key(large, j, size) == key) {
+			_storeKey(out, k++, key, size);
+		}
+	}
+	return(k);
+}
+
+//  Keys of a not in a much larger b.
+static inline __attribute__((always_inline)) long _differenceGallopSmall(const void* a, long na, const void* b, long nb, void* out, int size) {
+	long j = 0;
+	long k = 0;
+
+	for(long i = 0; i < na; i++) {
+		long key = _key(a, i, size);
+
+		j = _gallop(b, j, nb, key, size);
+		if(j == nb || _key(b, j, size) != key) {
+			_storeKey(out, k++, key, size);
+		}
+	}
+	return(k);
+}
+
+//  Keys of a not in a much smaller b: the runs of a between keys of b are copied whole.
+static inline __attribute__((always_inline)) long _differenceGallopLarge(const void* a, long na, const void* b, long nb, void* out, int size) {
+	long i = 0;
+	long k = 0;
+
+	for(long j = 0; j < nb && i < na; j++) {
+		long key = _key(b, j, size);
+		long position = _gallop(a, i, na, key, size);
+
+		memcpy(out + (k * size), a + (i * size), (position - i) * size);
+		k += position - i;
+		i = (position < na && _key(a, position, size) == key) ? position + 1 : position;
+	}
+	memcpy(out + (k * size), a + (i * size), (na - i) * size);
+
+	return(k + na - i);
+}
+
+//  Union of a much larger and a much smaller vector: the runs of large between keys of
+//  small are copied whole.
+static inline __attribute__((always_inline)) long _unionGallop(const void* large, long nl, const void* small, long ns, void* out, int size) {
+	long i = 0;
+	long k = 0;
+
+	for(long j = 0; j < ns; j++) {
+		long key = _key(small, j, size);
+		long position = _gallop(large, i, nl, key, size);
+
+		memcpy(out + (k * size), large + (i * size), (position - i) * size);
+		k += position - i;
+		i = (position < nl && _key(large, position, size) == key) ? position + 1 : position;
+		_storeKey(out, k++, key, size);
+	}
+	memcpy(out + (k * size), large + (i * size), (nl - i) * size);
+
+	return(k + nl - i);
+}
+
+static inline __attribute__((always_inline)) long _unionMerge(const void* a, long na, const void* b, long nb, void* out, int size) {
+	long i = 0;
+	long j = 0;
+	long k = 0;
+
+	while(i < na && j < nb) {
+		long x = _key(a, i, size);
+		long y = _key(b, j, size);
+
+		_storeKey(out, k++, x <= y ? x : y, size);
+		i += (x <= y);
+		j += (y <= x);
+	}
+	memcpy(out + (k * size), a + (i * size), (na - i) * size);
+	k += na - i;
+	memcpy(out + (k * size), b + (j * size), (nb - j) * size);
+
+	return(k + nb - j);
+}
+
+static inline __attribute__((always_inline)) long _runSetOperation(const void* a, long na, const void* b, long nb, void* out, int operation, int size) {
+	if(operation == _SET_INTERSECT) {
+		if(na * VECTOR_GALLOP_RATIO < nb) {
+			return(_intersectGallop(a, na, b, nb, out, size) );
+		}
+		if(nb * VECTOR_GALLOP_RATIO < na) {
+			return(_intersectGallop(b, nb, a, na, out, size) );
+		}
+		return(_matchBlocks(a, na, b, nb, out, 0, size) );
+	}
+	if(operation == _SET_DIFFERENCE) {
+		if(na * VECTOR_GALLOP_RATIO < nb) {
+			return(_differenceGallopSmall(a, na, b, nb, out, size) );
+		}
+		if(nb * VECTOR_GALLOP_RATIO < na) {
+			return(_differenceGallopLarge(a, na, b, nb, out, size) );
+		}
+		return(_matchBlocks(a, na, b, nb, out, 1, size) );
+	}
+	if(na * VECTOR_GALLOP_RATIO < nb) {
+		return(_unionGallop(b, nb, a, na, out, size) );
+	}
+	if(nb * VECTOR_GALLOP_RATIO < na) {
+		return(_unionGallop(a, na, b, nb, out, size) );
+	}
+	return(_unionMerge(a, na, b, nb, out, size) );
+}
+
+static int _setOperation(const Vector* a, const Vector* b, Vector* result, int operation) {
+	if(a == NULL || b == NULL || result == NULL) {
+		return(VECTOR_ERR_NULL_ARG);
+	}
+	int size = a->_elementSize;
+
+	if(size != b->_elementSize || (size != sizeof(int) && size != sizeof(long) ) ) {
+		return(VECTOR_ERR_INVALID_ARG);
+	}
+	long na = a->_size;
+	long nb = b->_size;
+	long bound = (operation == _SET_UNION) ? na + nb : (operation == _SET_DIFFERENCE || na < nb) ? na : nb;
+
+	//  Four keys of slack, one per lane of a block, for the branch-free writes of the
+	//  block kernels.
+	if(Vector_create(result, bound + 4, size, NULL) != VECTOR_FUNC_SUCCESS || result->_data == NULL) {
+		return(VECTOR_ERR_ALLOCATION);
+	}
+	if(size == sizeof(int) ) {
+		result->_size = _runSetOperation(a->_data, na, b->_data, nb, result->_data, operation, sizeof(int) );
+	}
+	else {
+		result->_size = _runSetOperation(a->_data, na, b->_data, nb, result->_data, operation, sizeof(long) );
+	}
+	//  The branch-free writes leave stale keys past the result; capacity beyond size is
+	//  kept zeroed.
+	memset(result->_data + (result->_size * size), '\0', (result->_capacity - result->_size) * size);
+
+	return(VECTOR_FUNC_SUCCESS);
+}
+
+int Vector_intersectSorted(const Vector* a, const Vector* b, Vector* result) {
+	return(_setOperation(a, b, result, _SET_INTERSECT) );
+}
+
+int Vector_unionSorted(const Vector* a, const Vector* b, Vector* result) {
+	return(_setOperation(a, b, result, _SET_UNION) );
+}
+
+int Vector_differenceSorted(const Vector* a, const Vector* b, Vector* result) {
+	return(_setOperation(a, b, result, _SET_DIFFERENCE) );
 }
\ No newline at end of file
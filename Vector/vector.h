@@ -5,6 +5,8 @@
 #include <stdlib.h>
 #include <string.h>
 
+#include "../Stats/atlstats.h"
+
 /////////////////////////////////////////////////////////////////////////////////////////
 //  Vector function return values
 /////////////////////////////////////////////////////////////////////////////////////////
@@ -14,6 +16,8 @@
 #define VECTOR_ERR_INVALID_ARG	 -2	// An invalid value has been passed to function
 #define VECTOR_ERR_ALLOCATION	 -3	// Vector capacity resize has failed
 #define VECTOR_ERR_OUT_OF_BOUNDS -4	// Attempted to access an index out of bounds of the vector
+#define VECTOR_ERR_IO			 -5	// A file operation on a mapped vector has failed
+#define VECTOR_ERR_READ_ONLY	 -6	// Attempted to modify a vector mapped read-only
 
 /////////////////////////////////////////////////////////////////////////////////////////
 // How much more memory is allocated (as a factor) over vector size when a vector data
@@ -21,6 +25,53 @@
 /////////////////////////////////////////////////////////////////////////////////////////
 #define CAPACITY_FACTOR	2
 
+/////////////////////////////////////////////////////////////////////////////////////////
+//  Vector backing storage modes.
+/////////////////////////////////////////////////////////////////////////////////////////
+#define VECTOR_STORAGE_HEAP			 0	// Data allocated with realloc (default)
+#define VECTOR_STORAGE_MAPPED		 1	// Data is a shared, writable mmap of a file
+#define VECTOR_STORAGE_MAPPED_RDONLY 2	// Data is a shared, read-only mmap of a file
+#define VECTOR_STORAGE_HUGE			 3	// Data is an anonymous mmap backed by huge pages
+
+/////////////////////////////////////////////////////////////////////////////////////////
+//  Vector_createHuge flags. VECTOR_HUGE_TLB and the NUMA flags are dropped from a
+//  vector's flags if the system turns them down, leaving what actually applies.
+/////////////////////////////////////////////////////////////////////////////////////////
+#define VECTOR_HUGE_TLB			1	// Use reserved 2 MB huge pages (MAP_HUGETLB) before transparent ones
+#define VECTOR_NUMA_INTERLEAVE	2	// Interleave pages across every NUMA node
+#define VECTOR_NUMA_BIND		4	// Place pages on the NUMA node passed to Vector_createHuge
+#define VECTOR_PREFAULT			8	// Fault every page in at allocation, from several threads
+
+#define VECTOR_HUGE_PAGE_SIZE	(2L << 20)	// Huge storage is mapped in multiples of this
+#define VECTOR_PREFAULT_CHUNK	(64L << 20)	// Bytes prefaulted per thread, at least
+#define VECTOR_PREFAULT_THREADS	16			// Most threads used to prefault
+
+/////////////////////////////////////////////////////////////////////////////////////////
+//  The sorted set operations switch from a linear merge to galloping search once one
+//  input is this many times larger than the other.
+/////////////////////////////////////////////////////////////////////////////////////////
+#define VECTOR_GALLOP_RATIO	32
+
+/////////////////////////////////////////////////////////////////////////////////////////
+//  Mapped vector file format. A mapped vector file starts with a header of
+//  VECTOR_FILE_HEADER_SIZE bytes followed directly by the element data:
+//		char[4] magic ("ATLV"), int version, int elementSize, long size, long capacity.
+//  The remainder of the header is zero padding so element data stays cache line aligned.
+/////////////////////////////////////////////////////////////////////////////////////////
+#define VECTOR_FILE_MAGIC		"ATLV"
+#define VECTOR_FILE_VERSION		1
+#define VECTOR_FILE_HEADER_SIZE	64
+
+/////////////////////////////////////////////////////////////////////////////////////////
+//  Vector stream format, as written by Vector_write. A frame header of
+//		char[4] magic ("ATSV"), int version, int elementSize, long count
+//  is followed directly by count * elementSize bytes of element data.
+//  VECTOR_IO_CHUNK_SIZE bounds the memory used by Vector_readStream.
+/////////////////////////////////////////////////////////////////////////////////////////
+#define VECTOR_STREAM_MAGIC		"ATSV"
+#define VECTOR_STREAM_VERSION	1
+#define VECTOR_IO_CHUNK_SIZE	(1 << 20)
+
 /////////////////////////////////////////////////////////////////////////////////////////
 //  Vector is the client-side data structure for a vector. The
 //  members within Vector will be managed with the Vector_...
@@ -30,6 +81,11 @@
 //  Member - _capacity:		Size of total allocated memory, in bytes, pointed to by _data.
 //  Member - _elementSize:	Size, in bytes, of each individual element in memory.
 //  Member - _elementDestructor:	Function pointer to client-side element destructor.
+//  Member - _storage:		Backing storage mode, one of VECTOR_STORAGE_... above.
+//  Member - _fd:			File descriptor of the backing file for mapped vectors, else -1.
+//  Member - _storageFlags:	VECTOR_HUGE_... and VECTOR_NUMA_... flags of huge storage.
+//  Member - _numaNode:		NUMA node of huge storage with VECTOR_NUMA_BIND.
+//  Member - _stats:		Instrumentation counters, only present when built with ATL_STATS.
 /////////////////////////////////////////////////////////////////////////////////////////
 typedef struct _Vector {
 	long _size;
@@ -37,6 +93,13 @@ typedef struct _Vector {
 	int _elementSize;
 	void* _data;
 	int (*_elementDestructor)(void*);
+	int _storage;
+	int _fd;
+	int _storageFlags;
+	int _numaNode;
+#ifdef ATL_STATS
+	AtlStats _stats;
+#endif
 } Vector;
 
 /////////////////////////////////////////////////////////////////////////////////////////
@@ -59,9 +122,175 @@ int Vector_create(Vector* vector, long capacity, int elementSize, int (*elementD
 //  Arg - vector: Pointer to the vector which is being destroyed.
 //
 //  Returns: VECTOR_... #defined above.
+//
+//  Note: For mapped vectors the elements are persistent, so no destructors are called.
+//		  The file is synced (unless mapped read-only), unmapped and closed instead.
 /////////////////////////////////////////////////////////////////////////////////////////
 int Vector_destroy(Vector* vector);
 
+/////////////////////////////////////////////////////////////////////////////////////////
+//  Transfers the contents of from to to in O(1): the elements, storage (including huge
+//  and mapped storage, whose mapping and file descriptor move along) and destructor.
+//
+//  Arg - to:	Pointer to the vector to initialize. It must not hold a live vector.
+//  Arg - from:	Pointer to the vector to move from.
+//
+//  Returns: VECTOR_... #defined above.
+//
+//  Note: from is left as after Vector_destroy, and must be created again before reuse.
+/////////////////////////////////////////////////////////////////////////////////////////
+int Vector_move(Vector* to, Vector* from);
+
+/////////////////////////////////////////////////////////////////////////////////////////
+//  Exchanges the contents of two vectors in O(1), as for double buffering.
+//
+//  Arg - a: Pointer to the first vector.
+//  Arg - b: Pointer to the second vector.
+//
+//  Returns: VECTOR_... #defined above.
+/////////////////////////////////////////////////////////////////////////////////////////
+int Vector_swap(Vector* a, Vector* b);
+
+/////////////////////////////////////////////////////////////////////////////////////////
+//  Initializes clone with a copy of every element of vector, with capacity for exactly
+//  its size. The clone has the same element destructor, and huge storage with the same
+//  flags if vector has it; a clone of a mapped vector lives on the heap.
+//
+//  Arg - clone:		Pointer to the vector which is being created.
+//  Arg - vector:		Pointer to the vector to copy. It is not modified.
+//  Arg - elementCopy:	Client-side function which copies the element at its second
+//						argument into the (zeroed) slot at its first, returning non-zero
+//						on failure; or NULL to copy every element in one memcpy.
+//
+//  Returns: VECTOR_... #defined above, or the non-zero value returned by elementCopy if
+//			 a copy failed, in which case the elements copied so far are destroyed.
+//
+//  Note: Without elementCopy elements are copied bitwise, so this is only right for
+//		  elements which own no memory.
+/////////////////////////////////////////////////////////////////////////////////////////
+int Vector_clone(Vector* clone, const Vector* vector, int (*elementCopy)(void*, const void*));
+
+/////////////////////////////////////////////////////////////////////////////////////////
+//  Initializes vector with anonymous mmap storage for very large vectors: huge pages
+//  cut TLB misses on random access, and NUMA placement keeps pages off the node which
+//  merely touched them first. Growth uses mremap, so pages are never copied.
+//
+//  Arg - vector:			 Pointer to the vector which is being created.
+//  Arg - capacity:			 Desired initial capacity, in elements.
+//  Arg - elementSize:		 Size, in bytes, of each individual element in memory.
+//  Arg - elementDestructor: Function pointer to client-side element destructor.
+//  Arg - flags:			 VECTOR_HUGE_TLB, VECTOR_NUMA_... and VECTOR_PREFAULT #defined
+//							 above, or 0 for transparent huge pages only.
+//  Arg - numaNode:			 Node to place pages on with VECTOR_NUMA_BIND, else ignored.
+//
+//  Returns: VECTOR_... #defined above.
+//
+//  Note: Each facility falls back on its own: without reserved huge pages the mapping
+//		  asks for transparent ones (MADV_HUGEPAGE), NUMA placement is skipped where the
+//		  kernel has none, and if no mapping can be made at all vector gets ordinary
+//		  heap storage. Vector_storage tells which storage vector ended up with.
+/////////////////////////////////////////////////////////////////////////////////////////
+int Vector_createHuge(Vector* vector, long capacity, int elementSize, int (*elementDestructor)(void*), int flags, int numaNode);
+
+/////////////////////////////////////////////////////////////////////////////////////////
+//  Returns backing storage mode of vector.
+//
+//  Arg - vector: Pointer to the vector.
+//
+//  Returns: One of VECTOR_STORAGE_... #defined above.
+/////////////////////////////////////////////////////////////////////////////////////////
+int Vector_storage(const Vector* vector);
+
+/////////////////////////////////////////////////////////////////////////////////////////
+//  Creates a new file at path and initializes vector with its data memory-mapped from
+//  that file. Growth extends the file with ftruncate and remaps it.
+//
+//  Arg - vector:			 Pointer to the vector which is being created.
+//  Arg - path:				 Path of the backing file. An existing file is truncated.
+//  Arg - capacity:			 Desired initial capacity, in elements.
+//  Arg - elementSize:		 Size, in bytes, of each individual element in memory.
+//  Arg - elementDestructor: Function pointer to client-side element destructor.
+//
+//  Returns: VECTOR_... #defined above.
+//
+//  Note: Elements are stored in the file verbatim, so they should not contain pointers.
+//		  The element count in the file header is only updated by Vector_sync and
+//		  Vector_destroy. If growth cannot remap the file, nor map it back at its old
+//		  size, the vector is left empty with no capacity; it must still be destroyed.
+/////////////////////////////////////////////////////////////////////////////////////////
+int Vector_createMapped(Vector* vector, const char* path, long capacity, int elementSize, int (*elementDestructor)(void*));
+
+/////////////////////////////////////////////////////////////////////////////////////////
+//  Initializes vector by memory-mapping an existing file written by a mapped vector.
+//  No element data is read or copied; pages are faulted in on first access.
+//
+//  Arg - vector:			 Pointer to the vector which is being created.
+//  Arg - path:				 Path of the backing file.
+//  Arg - readOnly:			 If non-zero the file is opened and mapped read-only, which
+//							 lets several processes share the same physical pages. Any
+//							 function which would modify the vector then returns
+//							 VECTOR_ERR_READ_ONLY.
+//  Arg - elementDestructor: Function pointer to client-side element destructor.
+//
+//  Returns: VECTOR_... #defined above. VECTOR_ERR_INVALID_ARG is returned if the file
+//			 header is missing, has a different version, or does not match the file size.
+/////////////////////////////////////////////////////////////////////////////////////////
+int Vector_mapFile(Vector* vector, const char* path, int readOnly, int (*elementDestructor)(void*));
+
+/////////////////////////////////////////////////////////////////////////////////////////
+//  Writes the current element count to the file header of a mapped vector and flushes
+//  the mapping to disk with msync.
+//
+//  Arg - vector: Pointer to the mapped vector.
+//
+//  Returns: VECTOR_... #defined above. VECTOR_ERR_INVALID_ARG is returned if vector is
+//			 not file-backed.
+/////////////////////////////////////////////////////////////////////////////////////////
+int Vector_sync(Vector* vector);
+
+/////////////////////////////////////////////////////////////////////////////////////////
+//  Serializes vector to a file descriptor as a single frame. The frame header and the
+//  whole element array are handed to the kernel together with writev.
+//
+//  Arg - vector: Pointer to the vector being written.
+//  Arg - fd:	  Open file descriptor to write to (file, pipe or socket).
+//
+//  Returns: VECTOR_... #defined above.
+//
+//  Note: Elements are written verbatim, so they should not contain pointers.
+/////////////////////////////////////////////////////////////////////////////////////////
+int Vector_write(const Vector* vector, int fd);
+
+/////////////////////////////////////////////////////////////////////////////////////////
+//  Initializes vector from a frame written by Vector_write. Element data is read
+//  directly into vector storage without intermediate copies.
+//
+//  Arg - vector:			 Pointer to the vector which is being created.
+//  Arg - fd:				 Open file descriptor to read from.
+//  Arg - elementDestructor: Function pointer to client-side element destructor.
+//
+//  Returns: VECTOR_... #defined above. VECTOR_ERR_INVALID_ARG is returned if the frame
+//			 header is not recognized, VECTOR_ERR_IO if the frame is truncated.
+/////////////////////////////////////////////////////////////////////////////////////////
+int Vector_read(Vector* vector, int fd, int (*elementDestructor)(void*));
+
+/////////////////////////////////////////////////////////////////////////////////////////
+//  Reads a frame written by Vector_write incrementally, passing each element to a
+//  callback instead of building a vector. At most VECTOR_IO_CHUNK_SIZE bytes (or one
+//  element, if larger) are resident at a time.
+//
+//  Arg - fd:				Open file descriptor to read from.
+//  Arg - elementCallback:	Called for each element in order with the element and
+//							context. A non-zero return value stops the read.
+//  Arg - context:			Client pointer passed through to elementCallback.
+//
+//  Returns: VECTOR_... #defined above, or the non-zero value returned by
+//			 elementCallback if it stopped the read.
+//
+//  Note: The element pointer is only valid for the duration of the callback.
+/////////////////////////////////////////////////////////////////////////////////////////
+int Vector_readStream(int fd, int (*elementCallback)(const void*, void*), void* context);
+
 /////////////////////////////////////////////////////////////////////////////////////////
 //	Resizes (and if neccessary allocates additional space for) vector. If new size is 
 //  smaller, old elements passed new size will be deallocated. If knew size is bigger,
@@ -222,4 +451,94 @@ int Vector_insert(Vector* vector, const void* data, long index);
 /////////////////////////////////////////////////////////////////////////////////////////
 int Vector_remove(Vector* vector, long index);
 
+/////////////////////////////////////////////////////////////////////////////////////////
+//  Grows vector by count elements starting at index and returns a pointer to the first
+//  of the new slots so the caller can construct elements directly in vector storage.
+//
+//  Arg - vector: Pointer to vector in which new slots will be opened.
+//  Arg - index:  Position within vector of the first new slot. May equal vector size,
+//				  in which case the slots are opened at the end of vector.
+//  Arg - count:  Number of contiguous slots to open.
+//
+//  Returns: Pointer to the first new slot, or NULL on error.
+//
+//  Note: Elements from index to size are shifted right by count using a single memmove.
+//		  The contents of the returned slots are unspecified and must be fully written
+//		  by the caller before any other Vector_... function touches them. Vector
+//		  capacity may be reallocated, invalidating previously returned pointers.
+//		  Successful execution will result in the vector size being incremented by count.
+/////////////////////////////////////////////////////////////////////////////////////////
+void* Vector_emplaceN(Vector* vector, long index, long count);
+
+/////////////////////////////////////////////////////////////////////////////////////////
+//  Grows vector by one element at index and returns a pointer to the new slot.
+//
+//  Arg - vector: Pointer to vector in which a new slot will be opened.
+//  Arg - index:  Position within vector of the new slot (0 to size, inclusive).
+//
+//  Returns: Pointer to the new slot, or NULL on error.
+//
+//  Note: Equivalent to Vector_emplaceN(vector, index, 1).
+/////////////////////////////////////////////////////////////////////////////////////////
+void* Vector_emplaceAt(Vector* vector, long index);
+
+/////////////////////////////////////////////////////////////////////////////////////////
+//  Grows vector by one element at its end and returns a pointer to the new slot.
+//
+//  Arg - vector: Pointer to vector in which a new slot will be opened.
+//
+//  Returns: Pointer to the new slot, or NULL on error.
+//
+//  Note: Equivalent to Vector_emplaceN(vector, Vector_size(vector), 1). The new slot is
+//		  zeroed since capacity beyond size is always kept zeroed.
+/////////////////////////////////////////////////////////////////////////////////////////
+void* Vector_emplaceBack(Vector* vector);
+
+/////////////////////////////////////////////////////////////////////////////////////////
+//  Removes all elements from index size onward.
+//
+//  Arg - vector: Pointer to the vector being truncated.
+//  Arg - size:	  New size of vector (0 to size, inclusive).
+//
+//  Returns: VECTOR_... #defined above.
+//
+//  Note: The client-side destructor is called on each removed element, then the whole
+//		  removed region is zeroed with a single memset. Capacity is unchanged.
+/////////////////////////////////////////////////////////////////////////////////////////
+int Vector_truncate(Vector* vector, long size);
+
+/////////////////////////////////////////////////////////////////////////////////////////
+//  Copies the instrumentation counters of vector.
+//
+//  Arg - vector: Pointer to the vector.
+//  Arg - stats:  Receives the counters.
+//
+//  Returns: ATLSTATS_... #defined in atlstats.h. ATLSTATS_DISABLED (with all counters
+//			 zeroed) if the library was built without ATL_STATS.
+/////////////////////////////////////////////////////////////////////////////////////////
+int Vector_stats(const Vector* vector, AtlStats* stats);
+
+/////////////////////////////////////////////////////////////////////////////////////////
+//  Set operations on sorted vectors of 32-bit (int) or 64-bit (long) keys: the
+//  intersection, the union, and the difference (keys of a not in b). Each writes into
+//  a new result vector, allocated once for the largest possible result.
+//
+//  Arg - a:	  Pointer to the first vector. Keys must be strictly ascending.
+//  Arg - b:	  Pointer to the second vector, with the same element size as a. Keys
+//				  must be strictly ascending.
+//  Arg - result: Pointer to the vector which is created to receive the result. It has
+//				  the element size of a and no element destructor.
+//
+//  Returns: VECTOR_... #defined above. VECTOR_ERR_INVALID_ARG is returned if the
+//			 element sizes differ or are not 4 or 8.
+//
+//  Note: When one input is VECTOR_GALLOP_RATIO times larger than the other, each key
+//		  of the smaller one is found in the larger with galloping (exponential)
+//		  search. Otherwise intersection and difference compare blocks of keys with
+//		  SSE2, where available, and union runs a branchless merge.
+/////////////////////////////////////////////////////////////////////////////////////////
+int Vector_intersectSorted(const Vector* a, const Vector* b, Vector* result);
+int Vector_unionSorted(const Vector* a, const Vector* b, Vector* result);
+int Vector_differenceSorted(const Vector* a, const Vector* b, Vector* result);
+
 #endif
\ No newline at end of file